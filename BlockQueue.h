@@ -0,0 +1,78 @@
+/*
+Block Queue
+
+A bounded queue that passes blocks of audio between the threads of a
+processing pipeline.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/* Block queue
+Push() waits while the queue holds capacity blocks, so a stage that runs
+ahead of the one after it stops instead of buffering the whole stream. Pop()
+waits for a block and returns false once the queue is closed and empty, which
+is how the producer tells the consumers that the stream is over. Any number
+of threads may push and pop.
+*/
+
+template<typename Block> class CBlockQueue
+{
+public:
+   CBlockQueue(size_t capacity) : m_capacity{ capacity ? capacity : 1 }
+   {
+   }
+
+   void Push(Block block)
+   {
+      std::unique_lock<std::mutex> lock{ m_mutex };
+      m_not_full.wait(lock, [this]() { return m_blocks.size() < m_capacity; });
+      m_blocks.push_back(std::move(block));
+      m_not_empty.notify_one();
+   }
+
+   bool Pop(Block& block)
+   {
+      std::unique_lock<std::mutex> lock{ m_mutex };
+      m_not_empty.wait(lock, [this]() { return !m_blocks.empty() || m_closed; });
+      if (m_blocks.empty())
+         return false;
+      block = std::move(m_blocks.front());
+      m_blocks.pop_front();
+      m_not_full.notify_one();
+      return true;
+   }
+
+   //wakes up the consumers once the remaining blocks are popped; nothing may be pushed afterwards
+   void Close()
+   {
+      std::lock_guard<std::mutex> lock{ m_mutex };
+      m_closed = true;
+      m_not_empty.notify_all();
+   }
+
+private:
+
+   const size_t m_capacity;
+   std::deque<Block> m_blocks;
+   bool m_closed = false;
+   std::mutex m_mutex;
+   std::condition_variable m_not_full;
+   std::condition_variable m_not_empty;
+};
@@ -0,0 +1,195 @@
+/*
+Cascade Doubler
+
+Multiplies the sampling rate by 4 or 8 with a chain of doubler stages that
+pass their output to each other in memory.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "StreamingDoubler.h"
+#include "FilterCache.h"
+#include <tuple>
+#include <utility>
+
+/* Cascade doubler
+Stage k doubles a signal sampled at 2^k times the original rate, but the signal
+still only occupies the original band. Its first image therefore starts far
+above the stage's Nyquist frequency, and the transition band of its filter
+could be that much wider, with a table STAGE_SHORTENING times narrower than
+that of the stage before it. The images the first stage leaves below its
+output Nyquist frequency, however, fall into that transition band, and a
+narrower table passes more of them: with tables halved at every stage the
+output deviates from that of full width stages by about -96db, with tables
+quartered by about -88db. The bound is the -120db FileUpsampler --verify
+checks against full width stages, so STAGE_SHORTENING is 1 and every stage
+uses the full table.
+
+The stages are streaming doublers. The input is fed to the first one in
+blocks small enough for the output of the last stage to stay in the cache, and
+every block goes through all the stages before the next one is read. The
+leading silence of every stage is dropped before the next stage sees it,
+since that stage would otherwise interpolate between the silence and the
+signal. Run() thus returns exactly Factor() frames per input frame, the same
+frames the stages would return if each of them upsampled the whole output of
+the one before it with SRDoubler::Run(). Process() and Flush() return the
+same frames for input that arrives in blocks, without any leading silence.
+*/
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width, size_t stages> class CCascadeDoubler
+{
+   static_assert(stages >= 1, "A cascade needs at least one stage");
+
+public:
+   using Doubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename Doubler::SampleFrame;
+   using FrameSpan = typename Doubler::FrameSpan;
+   using FrameVector = typename Doubler::FrameVector;
+   using CoefficientFormat = typename Doubler::CoefficientFormat;
+   using size_type = typename Doubler::size_type;
+
+   //the table of every stage is this many times narrower than the table of the stage before it
+   static const size_t STAGE_SHORTENING = 1;
+
+   //the narrowest table a stage gets
+   static const size_t MIN_STAGE_WIDTH = 64;
+
+   //the output of the last stage for one input block should fit into this many bytes
+   static const size_t BLOCK_BYTES = 256 * 1024;
+
+   static constexpr size_t Factor()
+   {
+      return size_t(1) << stages;
+   }
+
+   static constexpr size_t StageWidth(size_t stage)
+   {
+      size_t width = table_width;
+      for (size_t s = 0; s < stage; s++)
+         width = std::max(MIN_STAGE_WIDTH, width / STAGE_SHORTENING / 2 * 2);
+      return width;
+   }
+
+   //builds the Keiser window filter of every stage with the same alpha, or maps it from the filter cache
+   CCascadeDoubler(double alpha) :
+      m_filters{ makeFilters(alpha, std::make_index_sequence<stages>()) },
+      m_doublers{ makeDoublers(std::make_index_sequence<stages>()) }
+   {
+      resetSkip(std::make_index_sequence<stages>());
+   }
+
+   //appends the output for count more input frames to out
+   void Process(const SampleFrame * in, size_type count, FrameVector& out)
+   {
+      const size_type block_frames = std::max<size_type>(1, BLOCK_BYTES / (Factor() * sizeof(SampleFrame)));
+
+      m_output = &out;
+      for (size_type first = 0; first < count; first += block_frames)
+         process<0>(in + first, std::min(block_frames, count - first));
+   }
+
+   //appends the output for the last input frames to out and starts a new stream
+   void Flush(FrameVector& out)
+   {
+      m_output = &out;
+      flush<0>();
+      resetSkip(std::make_index_sequence<stages>());
+   }
+
+   FrameVector Run(const FrameSpan& in_span)
+   {
+      const size_type frames = static_cast<size_type>(in_span.size());
+      FrameVector output;
+      output.reserve(frames * Factor());
+
+      Process(in_span.data(), frames, output);
+      Flush(output);
+
+      return output;
+   }
+
+private:
+
+   template<size_t stage> using StageDoubler = CStreamingDoubler<SampleFormat, numChannels, StageWidth(stage)>;
+
+   template<typename Sequence> struct SStages;
+   template<size_t... stage> struct SStages<std::index_sequence<stage...>>
+   {
+      using Filters = std::tuple<CCachedHalfFilter<StageWidth(stage), CoefficientFormat>...>;
+      using Doublers = std::tuple<StageDoubler<stage>...>;
+   };
+   using Filters = typename SStages<std::make_index_sequence<stages>>::Filters;
+   using Doublers = typename SStages<std::make_index_sequence<stages>>::Doublers;
+
+   Filters m_filters;
+   Doublers m_doublers;                           //refer to m_filters
+   std::array<FrameVector, stages> m_buffers;     //the output of every stage for the current block
+   FrameVector * m_output = nullptr;              //the vector the output of the last stage is appended to
+   std::array<size_type, stages> m_skip{};        //leading silent frames of every stage still to be dropped
+
+   template<size_t... stage> static Filters makeFilters(double alpha, std::index_sequence<stage...>)
+   {
+      return Filters{ ((void)stage, alpha)... };
+   }
+
+   //streaming doublers refer to their own members and can't be moved, so they are constructed in place
+   template<size_t... stage> Doublers makeDoublers(std::index_sequence<stage...>) const
+   {
+      return Doublers{ std::get<stage>(m_filters).data()... };
+   }
+
+   template<size_t... stage> void resetSkip(std::index_sequence<stage...>)
+   {
+      m_skip = { { 2 * std::get<stage>(m_doublers).Latency()... } };
+   }
+
+   //runs count frames through the stages from this one on
+   template<size_t stage> void process(const SampleFrame * in, size_type count)
+   {
+      FrameVector& buffer = m_buffers[stage];
+      buffer.resize(2 * count);
+      std::get<stage>(m_doublers).Process(in, count, buffer.data());
+      pass<stage>(buffer);
+   }
+
+   //runs the remaining frames of this stage through the stages after it and resets the cascade
+   template<size_t stage> void flush()
+   {
+      FrameVector& buffer = m_buffers[stage];
+      buffer.resize(2 * std::get<stage>(m_doublers).Latency());
+      std::get<stage>(m_doublers).Flush(buffer.data());
+      pass<stage>(buffer);
+      if constexpr (stage + 1 < stages)
+         flush<stage + 1>();
+   }
+
+   //hands the output of this stage without its leading silence to the next stage or to the cascade output
+   template<size_t stage> void pass(const FrameVector& buffer)
+   {
+      size_type skipped = std::min(m_skip[stage], buffer.size());
+      m_skip[stage] -= skipped;
+
+      if constexpr (stage + 1 < stages)
+      {
+         if (skipped < buffer.size())
+            process<stage + 1>(buffer.data() + skipped, buffer.size() - skipped);
+      }
+      else
+      {
+         m_output->insert(m_output->end(), buffer.begin() + skipped, buffer.end());
+      }
+   }
+};
@@ -0,0 +1,125 @@
+/*
+FFT
+
+A self-contained radix-2 complex fast Fourier transform used by the
+frequency domain convolution engines.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <complex>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+/* Radix-2 FFT
+The class precomputes the twiddle factors and the bit reversal permutation
+for a power of two size. Neither transform is scaled, so Inverse(Forward(x))
+returns x multiplied by the size.
+*/
+
+class CFFT
+{
+public:
+   using Complex = std::complex<double>;
+
+   explicit CFFT(size_t size) : m_size{ size }, m_twiddles(size / 2), m_bit_reversal(size)
+   {
+      if (size < 2 || (size & (size - 1)) != 0)
+         throw std::runtime_error("FFT size should be a power of two");
+
+      const double PI_VALUE = 3.14159265358979323846264338327950288;
+
+      //every twiddle factor is calculated directly rather than by a recurrence to keep them accurate
+      for (size_t k = 0; k < size / 2; k++)
+         m_twiddles[k] = Complex(std::cos(2 * PI_VALUE * k / size), -std::sin(2 * PI_VALUE * k / size));
+
+      size_t bits = 0;
+      while ((size_t(1) << bits) < size)
+         bits++;
+      for (size_t i = 0; i < size; i++)
+      {
+         size_t reversed = 0;
+         for (size_t b = 0; b < bits; b++)
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+         m_bit_reversal[i] = reversed;
+      }
+   }
+
+   size_t Size() const
+   {
+      return m_size;
+   }
+
+   void Forward(Complex * data) const
+   {
+      transform(data, false);
+   }
+
+   void Inverse(Complex * data) const
+   {
+      transform(data, true);
+   }
+
+   //the smallest power of two that is not less than n
+   static size_t RoundUp(size_t n)
+   {
+      size_t size = 2;
+      while (size < n)
+         size *= 2;
+      return size;
+   }
+
+private:
+
+   size_t m_size;
+   std::vector<Complex> m_twiddles;
+   std::vector<size_t> m_bit_reversal;
+
+   //std::complex multiplication checks for infinities and NaNs, which makes it far slower than this
+   static Complex multiply(const Complex& a, const Complex& b)
+   {
+      return Complex(a.real()*b.real() - a.imag()*b.imag(), a.real()*b.imag() + a.imag()*b.real());
+   }
+
+   void transform(Complex * data, bool inverse) const
+   {
+      for (size_t i = 0; i < m_size; i++)
+      {
+         if (i < m_bit_reversal[i])
+            std::swap(data[i], data[m_bit_reversal[i]]);
+      }
+
+      for (size_t length = 2; length <= m_size; length *= 2)
+      {
+         size_t half = length / 2;
+         size_t stride = m_size / length;
+         for (size_t start = 0; start < m_size; start += length)
+         {
+            for (size_t j = 0; j < half; j++)
+            {
+               Complex twiddle = m_twiddles[j * stride];
+               if (inverse)
+                  twiddle = std::conj(twiddle);
+               Complex u = data[start + j];
+               Complex v = multiply(data[start + j + half], twiddle);
+               data[start + j] = u + v;
+               data[start + j + half] = u - v;
+            }
+         }
+      }
+   }
+};
@@ -0,0 +1,176 @@
+/*
+FFT Doubler
+
+An SRDoubler backend that convolves the input with the Keiser window filter
+in the frequency domain using the overlap-save method.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "FFT.h"
+
+/* Overlap-save doubler
+The interpolated frame following input frame i is the output n = i+halfWidth of
+a causal FIR filter whose impulse response is the (symmetric) filter table. The
+class calculates that FIR output block by block: every FFT_SIZE-point transform
+of the input, multiplied by the transform of the table, yields FFT_SIZE-table_width+1
+valid outputs. Two channels are filtered by a single complex transform, one as
+its real and the other as its imaginary part, since the table is real.
+
+Direct-form convolution is cheaper for short tables and short inputs, so for
+those the class delegates to SRDoubler.
+*/
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class CFFTDoubler
+{
+public:
+   using DirectDoubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename DirectDoubler::SampleFrame;
+   using FrameSpan = typename DirectDoubler::FrameSpan;
+   using FrameVector = typename DirectDoubler::FrameVector;
+   using CoefficientFormat = typename DirectDoubler::CoefficientFormat;
+   using size_type = typename DirectDoubler::size_type;
+   using index_type = typename DirectDoubler::index_type;
+   using Complex = CFFT::Complex;
+
+   //the shortest table the overlap-save method beats the vectorized direct form for
+   static const size_t MIN_TABLE_WIDTH = 512;
+
+   //the transform is this many times longer than the table, which balances its cost against the valid outputs per block
+   static const size_t FFT_SIZE_FACTOR = 4;
+
+   static const size_t FFT_SIZE = (table_width * FFT_SIZE_FACTOR < 2) ? 2 : table_width * FFT_SIZE_FACTOR;
+
+   template<typename FilterType>
+   CFFTDoubler(const FrameSpan& in_span, const FilterType& filter) : m_in_span{ in_span }, m_direct{ in_span, filter }
+   {
+      //for an input much shorter than the table most of every transform would be wasted on padding
+      m_use_fft = table_width >= MIN_TABLE_WIDTH && static_cast<size_t>(in_span.size()) >= table_width;
+      if (m_use_fft)
+         prepareSpectrum(m_direct.Coefficients());
+   }
+
+   //true if the frequency domain path is used, false if the class falls back to direct form
+   bool UsesFFT() const
+   {
+      return m_use_fft;
+   }
+
+   FrameVector Run() const
+   {
+      FrameVector output(2 * m_in_span.size());
+
+      run(output.data());
+
+      return output;
+   }
+
+   void Run(FrameSpan& out_span)
+   {
+      if (out_span.size() < 2 * m_in_span.size())
+         throw std::runtime_error("Output span is too short");
+
+      run(out_span.data());
+   }
+
+private:
+
+   const FrameSpan& m_in_span;
+   DirectDoubler m_direct;
+   bool m_use_fft = false;
+   std::unique_ptr<CFFT> m_fft;
+   std::vector<Complex> m_spectrum;   //transform of the table, scaled by 1/FFT size
+
+   const index_type halfWidth = table_width / 2;
+
+   void prepareSpectrum(const CoefficientFormat * coefficients)
+   {
+      const size_t size = CFFT::RoundUp(FFT_SIZE);
+      m_fft = std::make_unique<CFFT>(size);
+      m_spectrum.assign(size, Complex());
+
+      //unfold the distance ordered coefficients into the full symmetric table
+      for (index_type dist = 0; dist < halfWidth; dist++)
+      {
+         m_spectrum[halfWidth + dist] = CoefficientValue(coefficients[dist]) / size;
+         m_spectrum[halfWidth - 1 - dist] = CoefficientValue(coefficients[dist]) / size;
+      }
+
+      m_fft->Forward(m_spectrum.data());
+   }
+
+   void run(SampleFrame * out) const
+   {
+      if (!m_use_fft)
+      {
+         FrameSpan out_span{ out, 2 * m_in_span.size() };
+         DirectDoubler{ m_in_span, m_direct.Coefficients() }.Run(out_span);
+         return;
+      }
+
+      const index_type frames = m_in_span.size();
+      const SampleFrame * in = m_in_span.data();
+
+      //even output frames are the input frames
+      for (index_type i = 0; i < frames; i++)
+         out[2 * i] = in[i];
+
+      const index_type size = static_cast<index_type>(m_fft->Size());
+      const index_type block = size - table_width + 1;
+      std::vector<Complex> buffer(static_cast<size_t>(size));
+
+      for (size_t first_channel = 0; first_channel < numChannels; first_channel += 2)
+      {
+         const bool pair = first_channel + 1 < numChannels;
+
+         //FIR outputs n from halfWidth to frames+halfWidth-1 are the interpolated frames
+         for (index_type block_start = halfWidth; block_start < frames + halfWidth; block_start += block)
+         {
+            //the segment that ends with the last input of the block and starts table_width-1 frames before its first output
+            index_type segment_start = block_start - (table_width - 1);
+            for (index_type m = 0; m < size; m++)
+            {
+               index_type i = segment_start + m;
+               if (i >= 0 && i < frames)
+                  buffer[m] = Complex(double(in[i][first_channel]), pair ? double(in[i][first_channel + 1]) : 0.);
+               else
+                  buffer[m] = Complex();
+            }
+
+            m_fft->Forward(buffer.data());
+            for (index_type m = 0; m < size; m++)
+            {
+               const Complex& a = buffer[m];
+               const Complex& b = m_spectrum[m];
+               buffer[m] = Complex(a.real()*b.real() - a.imag()*b.imag(), a.real()*b.imag() + a.imag()*b.real());
+            }
+            m_fft->Inverse(buffer.data());
+
+            //only the last block outputs are free of circular wraparound
+            for (index_type m = table_width - 1; m < size; m++)
+            {
+               index_type i = block_start + (m - (table_width - 1)) - halfWidth;
+               if (i >= frames)
+                  break;
+               out[2 * i + 1][first_channel] = ToSample<SampleFormat>(buffer[m].real());
+               if (pair)
+                  out[2 * i + 1][first_channel + 1] = ToSample<SampleFormat>(buffer[m].imag());
+            }
+         }
+      }
+   }
+};
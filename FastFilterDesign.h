@@ -0,0 +1,213 @@
+/*
+Fast Filter Design
+
+Calculates Keiser window filter tables much faster than CFilter and
+CHalfFilter do, so that tables can be designed at run time for every job.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+
+/* Polynomial I0
+The power series of I0 is a polynomial in t = z*z/4 with the coefficients
+1/(k!)^2. Since the terms of a table never exceed z = alpha, the class sums
+the series up to the degree at which the terms of the largest argument drop
+below the double precision of I0(alpha), and evaluates it with Horner's rule,
+which has no branches and no divisions. Evaluate() runs Horner's rule over a
+block of arguments at once, coefficient by coefficient, so that the compiler
+vectorizes the inner loop. Keiser window arguments give t = alpha^2*(1-x^2)/4
+directly, so no square root is taken either.
+*/
+
+class CPolynomialI0
+{
+public:
+   CPolynomialI0(double max_z)
+   {
+      const double max_t = max_z * max_z / 4;
+      double coefficient = 1, term = 1, sum = 1;
+      m_coefficients.push_back(coefficient);
+      for (double k = 1; term > sum * TERM_PRECISION || k <= 1; k++)
+      {
+         coefficient /= k * k;
+         term = coefficient * std::pow(max_t, k);
+         sum += term;
+         m_coefficients.push_back(coefficient);
+      }
+   }
+
+   size_t Degree() const
+   {
+      return m_coefficients.size() - 1;
+   }
+
+   //I0 of the argument whose square is 4*t
+   double operator()(double t) const
+   {
+      double sum = m_coefficients.back();
+      for (size_t k = Degree(); k-- > 0;)
+         sum = sum * t + m_coefficients[k];
+      return sum;
+   }
+
+   //out[i] = I0 of the argument whose square is 4*t[i]
+   void Evaluate(const double * t, double * out, size_t count) const
+   {
+      const double * coefficients = m_coefficients.data();
+      const double highest = m_coefficients.back();
+      for (size_t i = 0; i < count; i++)
+         out[i] = highest;
+      for (size_t k = Degree(); k-- > 0;)
+      {
+         const double coefficient = coefficients[k];
+         for (size_t i = 0; i < count; i++)
+            out[i] = out[i] * t[i] + coefficient;
+      }
+   }
+
+private:
+
+   static constexpr double TERM_PRECISION = 1E-18;   //relative to the sum, below half an ulp of a double
+
+   std::vector<double> m_coefficients;   //1/(k!)^2 for k from 0 to the degree
+};
+
+/* Fast Keiser window filter design
+FastKeiserHalfTable() writes the halfWidth coefficients of CHalfFilter: the
+coefficient dist is the Keiser window mapped over the range from 0 to
+halfWidth+1 at dist+0.5, multiplied by sinc(dist+0.5). The arguments of sinc
+are half-integers, for which sin(PI*x) is exactly +1 or -1, so no sine is
+calculated. The window is calculated with CPolynomialI0 in blocks of
+DESIGN_BLOCK coefficients, and tables with more than MIN_TAPS_PER_THREAD
+coefficients are split between up to threads threads.
+
+FastSinc() calculates sinc over evenly spaced arguments by rotating a unit
+vector instead of calling sin() for every one; the rotation is restarted
+from sin() and cos() every SINC_RESTART values, which keeps the accumulated
+rounding error negligible, and next to zero, where dividing by x would
+magnify it.
+*/
+
+const size_t DESIGN_BLOCK = 256;
+const size_t MIN_TAPS_PER_THREAD = 16384;
+const size_t SINC_RESTART = 64;
+
+//out[i] = Kaiser(x[i], alpha) for x[i] in [0, 1], with poly built for alpha and inverse_I0_alpha = 1/I0(alpha)
+inline void FastKaiser(const CPolynomialI0& poly, double alpha, double inverse_I0_alpha, const double * x, double * out, size_t count)
+{
+   double t[DESIGN_BLOCK];
+   const double alpha2_4 = alpha * alpha / 4;
+   for (size_t first = 0; first < count; first += DESIGN_BLOCK)
+   {
+      size_t block = std::min(DESIGN_BLOCK, count - first);
+      for (size_t i = 0; i < block; i++)
+         t[i] = alpha2_4 * (1. - x[first + i] * x[first + i]);
+      poly.Evaluate(t, out + first, block);
+      for (size_t i = 0; i < block; i++)
+         out[first + i] *= inverse_I0_alpha;
+   }
+}
+
+//out[k] = sinc(first + k*step) for k from 0 to count-1
+inline void FastSinc(double first, double step, size_t count, double * out)
+{
+   const double rotation_cos = cos(PI * step), rotation_sin = sin(PI * step);
+   double s = 0, c = 0;
+   for (size_t k = 0; k < count; k++)
+   {
+      double x = first + k * step;
+      if (k % SINC_RESTART == 0 || std::abs(x) < 1.)
+      {
+         s = sin(PI * x);
+         c = cos(PI * x);
+      }
+      else
+      {
+         double rotated_s = s * rotation_cos + c * rotation_sin;
+         c = c * rotation_cos - s * rotation_sin;
+         s = rotated_s;
+      }
+      out[k] = (x == 0.) ? 1. : s / (PI * x);
+   }
+}
+
+//runs design(first, last) for ranges of at least MIN_TAPS_PER_THREAD of count items on up to threads threads
+template<typename Design> inline void DesignInParallel(size_t count, size_t items_per_tap, unsigned threads, Design design)
+{
+   size_t chunks = std::max<size_t>(1, std::min<size_t>(threads, count * items_per_tap / MIN_TAPS_PER_THREAD));
+   std::vector<std::thread> workers;
+   for (size_t chunk = 1; chunk < chunks; chunk++)
+      workers.emplace_back(design, count * chunk / chunks, count * (chunk + 1) / chunks);
+   design(0, count / chunks);
+   for (std::thread& worker : workers)
+      worker.join();
+}
+
+template<typename CoefficientFormat>
+inline void FastKeiserHalfTable(double alpha, size_t halfWidth, CoefficientFormat * out, unsigned threads = 1)
+{
+   const CPolynomialI0 poly{ alpha };
+   const double inverse_I0_alpha = 1. / poly(alpha * alpha / 4);
+
+   DesignInParallel(halfWidth, 1, threads, [&](size_t first, size_t last)
+   {
+      double x[DESIGN_BLOCK], window[DESIGN_BLOCK];
+      for (size_t block_first = first; block_first < last; block_first += DESIGN_BLOCK)
+      {
+         size_t block = std::min(DESIGN_BLOCK, last - block_first);
+         for (size_t i = 0; i < block; i++)
+            x[i] = (block_first + i + 0.5) / (halfWidth + 1);
+         FastKaiser(poly, alpha, inverse_I0_alpha, x, window, block);
+         for (size_t i = 0; i < block; i++)
+         {
+            size_t dist = block_first + i;
+            double sinc_value = ((dist & 1) ? -1. : 1.) / (PI * (dist + 0.5));
+            out[dist] = QuantizeCoefficient<CoefficientFormat>(window[i] * sinc_value);
+         }
+      }
+   });
+}
+
+//the largest difference between the fast design and CHalfFilter in double precision
+template<size_t table_width> inline double FastDesignDeviation(double alpha)
+{
+   const CHalfFilter<table_width> reference{ alpha };
+   std::vector<double> fast(table_width / 2);
+   FastKeiserHalfTable(alpha, table_width / 2, fast.data());
+
+   double deviation = 0;
+   for (size_t dist = 0; dist < fast.size(); dist++)
+      deviation = std::max(deviation, std::abs(fast[dist] - reference[dist]));
+   return deviation;
+}
+
+//the same for a width chosen at run time, with the reference coefficients calculated the way CHalfFilter does
+inline double FastDesignDeviation(double alpha, size_t table_width)
+{
+   const size_t halfWidth = table_width / 2;
+   const double I0_alpha = I0(alpha);
+   std::vector<double> fast(halfWidth);
+   FastKeiserHalfTable(alpha, halfWidth, fast.data());
+
+   double deviation = 0;
+   for (size_t dist = 0; dist < halfWidth; dist++)
+   {
+      double reference = KaiserMappedOverIntegerRange(dist + 0.5, alpha, I0_alpha, 0, halfWidth + 1) * sinc(dist + 0.5);
+      deviation = std::max(deviation, std::abs(fast[dist] - reference));
+   }
+   return deviation;
+}
@@ -17,61 +17,1255 @@ THE SOFTWARE.
 
 */
 #include "FileUpsampler.h"
+#include "FFTDoubler.h"
+#include "CascadeDoubler.h"
+#include "PolyphaseResampler.h"
+#include "PartitionedDoubler.h"
+#include "MappedWaveFile.h"
+#include "BlockQueue.h"
+#include "FilterCache.h"
+#include "MinimumPhaseDoubler.h"
+#include "UpsamplerStats.h"
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <cstring>
 #include "libsndfile\include\sndfile.h"
 
-using std::cout;
+//messages go to the console, or to the report of the file a batch job converts
+static thread_local std::ostream * t_console = &std::cout;
+
+static std::ostream& console()
+{
+   return *t_console;
+}
 
 const size_t TABLE_WIDTH = 3200;         //width of a filter table
 const double ALPHA = 9;                  //parameter of a Kaiser function
+const sf_count_t IO_BLOCK_FRAMES = 65536; //frames (de)interleaved per libsndfile call in the planar mode
+const double VERIFY_TOLERANCE = 10E-7;   //-120db, the bound ConstExprDemo checks
+const double DESIGN_TOLERANCE = 1E-12;   //largest deviation of a fast filter design coefficient from the reference one
+const size_t PIPELINE_MEMORY = 64 << 20; //bytes the pipeline may hold in its blocks unless --memory gives another budget
+const size_t MIN_TAPS = 4;               //range of the table widths --taps accepts
+const size_t MAX_TAPS = 65536;
 
-int main(int argc, char ** argv)
+//the table widths --quality selects, from the fastest to the most accurate; all of them are standard ones
+struct SQualityPreset
 {
-   //create an appropriate Keiser window filter
-   static CFilter<TABLE_WIDTH> KEISER_FILTER{ ALPHA };
+   const char * name;
+   size_t taps;
+};
+const SQualityPreset QUALITY_PRESETS[] = { { "draft", 64 }, { "low", 256 }, { "medium", 1024 }, { "high", 3200 }, { "maximum", 8192 } };
+
+using milliseconds_type = std::chrono::duration<double, std::milli>;
+
+template<typename SampleFormat> using CoefficientFormatFor = typename SRDoubler<SampleFormat, 1, TABLE_WIDTH>::CoefficientFormat;
+template<typename SampleFormat> using KeiserFilterFor = CCachedHalfFilter<TABLE_WIDTH, CoefficientFormatFor<SampleFormat>>;
 
-   if (argc != 3)
+//returns the coefficients of the Keiser window filter in the precision SampleFormat is processed with; only its symmetric half is stored
+//TABLE_WIDTH and ALPHA are presets of FilterTableGenerator, so the table is compiled into the program; tables of other widths are
+//designed or mapped from the filter cache once per process
+template<typename SampleFormat> static const CoefficientFormatFor<SampleFormat> * getKeiserFilter(size_t width = TABLE_WIDTH)
+{
+   static const KeiserFilterFor<SampleFormat> KEISER_FILTER{ ALPHA };
+   if (width == TABLE_WIDTH)
+      return KEISER_FILTER.data();
+
+   using DynamicFilterType = CCachedHalfFilter<DYNAMIC_TABLE_WIDTH, CoefficientFormatFor<SampleFormat>>;
+   static std::mutex mutex;
+   static std::map<size_t, std::unique_ptr<DynamicFilterType>> filters;
+   std::lock_guard<std::mutex> lock{ mutex };
+   std::unique_ptr<DynamicFilterType>& filter = filters[width];
+   if (!filter)
+      filter = std::make_unique<DynamicFilterType>(ALPHA, FilterDesign::Keiser, width);
+   return filter->data();
+}
+
+//returns the phase tables of the minimum phase version of the Keiser window filter, which are designed once and cached
+template<typename SampleFormat> static const CoefficientFormatFor<SampleFormat> * getMinimumPhaseFilter()
+{
+   static const KeiserFilterFor<SampleFormat> MINIMUM_PHASE_FILTER{ ALPHA, FilterDesign::MinimumPhase };
+   return MINIMUM_PHASE_FILTER.data();
+}
+
+struct SUpsamplerOptions
+{
+   bool planar = false;       //process every channel as a separate buffer
+   bool use_float = false;    //process float32 samples instead of double
+   bool integer = false;      //process PCM samples as 16 or 32 bit integers
+   bool verify = false;       //compare the result to the double precision path
+   bool fft = false;          //convolve in the frequency domain
+   unsigned threads = 1;      //threads the direct form convolution runs on
+   unsigned factor = 2;       //ratio of the output and input sampling rates, 2, 4 or 8
+   int rate = 0;              //output sampling rate if given instead of the factor
+   size_t up = 0;             //terms of the ratio for the polyphase resampler, 0 if the rate is multiplied by the factor
+   size_t down = 0;
+   const char * input = nullptr;   //path of the input file, mapped into memory rather than read if possible
+   size_t memory = 0;         //bytes the chunked mode may hold in its buffers, 0 to process the whole file in memory
+   bool pipeline = false;     //read, upsample and write blocks on separate threads
+   bool minimum_phase = false;   //double with the minimum phase filter, which has no lookahead
+   size_t taps = TABLE_WIDTH; //width of the filter table the direct form doublers use
+   CUpsamplerStats * stats = nullptr;   //where the stages of the conversion are timed and its work is counted
+
+   //true if the rate is simply doubled, which SRDoubler and CFFTDoubler do
+   bool doubling() const
    {
-      cout << "Usage: SrDoubler <input file> <output file>\n";
-      return 0;
+      return up == 0 && factor == 2 && !minimum_phase;
+   }
+};
+
+static sf_count_t outputFrames(sf_count_t input_frames, const SUpsamplerOptions& options)
+{
+   if (options.up)
+      return CPolyphaseResampler<double, 1, TABLE_WIDTH>::OutputFrames(input_frames, options.up, options.down);
+   return input_frames * options.factor;
+}
+
+//changes the sampling rate when SRDoubler doesn't simply double it: by 4 or 8 with a cascade of doublers, by other ratios with the polyphase resampler,
+//or by 2 with the minimum phase doubler
+template<typename SampleFormat, uint8_t numChannels>
+static typename SRDoubler<SampleFormat, numChannels, TABLE_WIDTH>::FrameVector resampleFrames(const typename SRDoubler<SampleFormat, numChannels, TABLE_WIDTH>::FrameSpan& in_span, const SUpsamplerOptions& options)
+{
+   if (options.minimum_phase)
+   {
+      auto doubler = TimeStage(options.stats, UpsamplerStage::Design, []() { return CMinimumPhaseDoubler<SampleFormat, numChannels, TABLE_WIDTH>{ getMinimumPhaseFilter<SampleFormat>() }; });
+      return doubler.Run(in_span);
+   }
+   if (options.up)
+   {
+      auto resampler = TimeStage(options.stats, UpsamplerStage::Design, [&]() { return CPolyphaseResampler<SampleFormat, numChannels, TABLE_WIDTH>{ in_span, options.up, options.down, ALPHA }; });
+      return resampler.Run();
+   }
+   if (options.factor == 8)
+   {
+      auto cascade = TimeStage(options.stats, UpsamplerStage::Design, []() { return CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 3>{ ALPHA }; });
+      return cascade.Run(in_span);
+   }
+   auto cascade = TimeStage(options.stats, UpsamplerStage::Design, []() { return CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 2>{ ALPHA }; });
+   return cascade.Run(in_span);
+}
+
+/* Direct form doubling
+The doublers are dispatched to the instantiation for the table width the
+options give if it is a standard one, and to the one of a dynamic width
+otherwise. The streaming engines of the chunked and pipelined modes always
+have a dynamic width: they are entered once per block, and one type of them
+serves every width.
+*/
+template<typename SampleFormat, uint8_t numChannels>
+static typename SRDoubler<SampleFormat, numChannels, TABLE_WIDTH>::FrameVector doubleFrames(const typename SRDoubler<SampleFormat, numChannels, TABLE_WIDTH>::FrameSpan& in_span, const SUpsamplerOptions& options)
+{
+   auto coefficients = TimeStage(options.stats, UpsamplerStage::Design, [&]() { return getKeiserFilter<SampleFormat>(options.taps); });
+   return DispatchTableWidth(options.taps, [&](auto width)
+   {
+      return SRDoubler<SampleFormat, numChannels, decltype(width)::value>{ in_span, coefficients, options.taps }.Run(options.threads);
+   });
+}
+
+template<typename SampleFormat>
+static typename CPlanarDoubler<SampleFormat, TABLE_WIDTH>::ChannelVectors doubleChannels(const typename CPlanarDoubler<SampleFormat, TABLE_WIDTH>::ChannelSpans& in_spans, const SUpsamplerOptions& options)
+{
+   auto coefficients = TimeStage(options.stats, UpsamplerStage::Design, [&]() { return getKeiserFilter<SampleFormat>(options.taps); });
+   return DispatchTableWidth(options.taps, [&](auto width)
+   {
+      return CPlanarDoubler<SampleFormat, decltype(width)::value>{ in_spans, coefficients, options.taps }.Run(options.threads);
+   });
+}
+
+//multiply-accumulates a direct form convolution needs to produce the output, the work done whichever engine runs
+static uint64_t filterMacs(sf_count_t input_frames, size_t channels, const SUpsamplerOptions& options)
+{
+   if (options.up)
+      return static_cast<uint64_t>(outputFrames(input_frames, options)) * channels * CPolyphaseResampler<double, 1, TABLE_WIDTH>::PhaseWidth(options.up, options.down);
+   if (options.minimum_phase)
+      return static_cast<uint64_t>(input_frames) * channels * 2 * TABLE_WIDTH;   //no frame is passed through
+
+   //every stage of a cascade interpolates as many frames as it gets with a table of its own width
+   uint64_t macs = 0, frames = static_cast<uint64_t>(input_frames);
+   if (options.doubling())
+      return frames * channels * options.taps;
+   for (size_t stage = 0; (size_t(2) << stage) <= options.factor; stage++, frames *= 2)
+      macs += frames * channels * CCascadeDoubler<double, 1, TABLE_WIDTH, 3>::StageWidth(stage);
+   return macs;
+}
+
+template<typename SampleFormat> static const char * sampleFormatName()
+{
+   if constexpr (std::is_same<SampleFormat, double>::value)
+      return "double";
+   else if constexpr (std::is_same<SampleFormat, float>::value)
+      return "float";
+   else if constexpr (std::is_same<SampleFormat, int16_t>::value)
+      return "int16";
+   else
+      return "int32";
+}
+
+//describes the conversion about to start
+static void printConversion(const SUpsamplerOptions& options, const char * mode)
+{
+   console() << "About to start " << mode;
+   if (options.minimum_phase)
+      console() << "minimum phase upsampling (" << MinimumPhaseDelay(getMinimumPhaseFilter<double>(), TABLE_WIDTH) / 2 << " frames of delay)";
+   else if (options.up)
+      console() << options.up << "/" << options.down << " polyphase resampling";
+   else
+      console() << options.factor << "x cascade upsampling";
+   console() << " with " << SimdLevelName(ActiveSimdLevel()) << " kernels...\n";
+}
+
+inline sf_count_t readFrames(SNDFILE * in, double * frames, sf_count_t count) { return sf_readf_double(in, frames, count); }
+inline sf_count_t readFrames(SNDFILE * in, float * frames, sf_count_t count) { return sf_readf_float(in, frames, count); }
+inline sf_count_t readFrames(SNDFILE * in, int16_t * frames, sf_count_t count) { return sf_readf_short(in, frames, count); }
+inline sf_count_t readFrames(SNDFILE * in, int32_t * frames, sf_count_t count) { return sf_readf_int(in, frames, count); }
+inline sf_count_t writeFrames(SNDFILE * out, const double * frames, sf_count_t count) { return sf_writef_double(out, frames, count); }
+inline sf_count_t writeFrames(SNDFILE * out, const float * frames, sf_count_t count) { return sf_writef_float(out, frames, count); }
+inline sf_count_t writeFrames(SNDFILE * out, const int16_t * frames, sf_count_t count) { return sf_writef_short(out, frames, count); }
+inline sf_count_t writeFrames(SNDFILE * out, const int32_t * frames, sf_count_t count) { return sf_writef_int(out, frames, count); }
+
+/* Doubles one channel by plain direct convolution, with coefficients of the
+reference design rather than the fast one and none of the filter cache, the
+kernels, the threads or the engines, so that it is an independent reference
+for any doubling mode. The input is zero outside of its span, as in SRDoubler.
+*/
+static std::vector<double> directDoubling(const std::vector<double>& input, size_t width)
+{
+   const ptrdiff_t halfWidth = width / 2, frames = input.size();
+   const double I0_alpha = I0(ALPHA);
+   std::vector<double> coefficients(halfWidth);
+   for (ptrdiff_t dist = 0; dist < halfWidth; dist++)
+      coefficients[dist] = KaiserMappedOverIntegerRange(dist + 0.5, ALPHA, I0_alpha, 0, halfWidth + 1) * sinc(dist + 0.5);
+
+   std::vector<double> output(2 * input.size());
+   for (ptrdiff_t i = 0; i < frames; i++)
+   {
+      double sum = 0;
+      for (ptrdiff_t dist = 0; dist < halfWidth; dist++)
+      {
+         if (i - dist >= 0)
+            sum += coefficients[dist] * input[i - dist];
+         if (i + 1 + dist < frames)
+            sum += coefficients[dist] * input[i + 1 + dist];
+      }
+      output[2 * i] = input[i];
+      output[2 * i + 1] = sum;
+   }
+   return output;
+}
+
+/* Compares an upsampled signal to a double precision one from the same input.
+A doubling is compared to directDoubling(), so an error of the doubler's
+design, kernels or engines shows up whatever the mode, and a cascade to
+directDoubling() repeated with the full table width at every stage, so the
+images its shortened later stages leave are checked as well. The minimum
+phase doubler and the polyphase resampler are compared to the double
+precision path of the same conversion, which only catches the errors of the
+sample format. input_at(c, i) and output_at(c, i) should return sample i of
+channel c. Integer samples are compared as fractions of full scale and may
+deviate by one LSB for every time they are rounded to it, which every stage
+of a cascade does.
+*/
+template<typename SampleFormat, typename InputAt, typename OutputAt>
+static bool verifyAgainstDouble(sf_count_t frames, size_t channels, const SUpsamplerOptions& options, InputAt input_at, OutputAt output_at)
+{
+   using MonoDoubler = SRDoubler<double, 1, TABLE_WIDTH>;
+
+   CStageTimer timer{ options.stats, UpsamplerStage::Verify };
+   const bool direct = !options.up && !options.minimum_phase;
+   console() << (direct ? "Verifying against a direct convolution in double precision...\n" : "Verifying against the double precision path...\n");
+
+   //the tables are designed with the fast generator, which should match the reference design; --taps only changes the doubling one
+   double design_deviation = options.doubling() ? FastDesignDeviation(ALPHA, options.taps) : FastDesignDeviation<TABLE_WIDTH>(ALPHA);
+   console() << "The fast filter design deviates from the reference one by " << design_deviation << "\n";
+
+   //value of one integer LSB, or 1 for floating point samples
+   const double scale = std::is_floating_point<SampleFormat>::value ? 1. : std::ldexp(1., -int(8 * sizeof(SampleFormat) - 1));
+   const unsigned roundings = options.up ? 1 : (options.factor == 8 ? 3 : options.factor == 4 ? 2 : 1);
+   const double tolerance = std::max(VERIFY_TOLERANCE, std::is_floating_point<SampleFormat>::value ? 0. : roundings * scale);
+
+   double max_error = 0;
+   for (size_t c = 0; c < channels; c++)
+   {
+      std::vector<double> samples(static_cast<size_t>(frames));
+      for (size_t i = 0; i < samples.size(); i++)
+         samples[i] = scale * double(input_at(c, i));
+
+      std::vector<double> reference;
+      if (direct)
+      {
+         const size_t width = options.doubling() ? options.taps : TABLE_WIDTH;
+         reference = samples;
+         for (unsigned factor = 1; factor < options.factor; factor *= 2)
+            reference = directDoubling(reference, width);
+      }
+      else
+      {
+         MonoDoubler::FrameVector reference_input(samples.size());
+         for (size_t i = 0; i < samples.size(); i++)
+            reference_input[i][0] = samples[i];
+         MonoDoubler::FrameSpan reference_span{ reference_input };
+         for (const auto& frame : resampleFrames<double, 1>(reference_span, options))
+            reference.push_back(frame[0]);
+      }
+
+      for (size_t i = 0; i < reference.size(); i++)
+      {
+         double expected = reference[i];
+         if (!std::is_floating_point<SampleFormat>::value)
+            expected = std::min(std::max(expected, -1.), 1. - scale);   //the integer path saturates
+         max_error = std::max(max_error, std::abs(expected - scale * double(output_at(c, i))));
+      }
+   }
+
+   bool match = max_error <= tolerance && design_deviation <= DESIGN_TOLERANCE;
+   console() << "Maximum deviation is " << max_error << " (" << 20 * std::log10(max_error) << " dB), ";
+   console() << ((match) ? "accuracy confirmed\n" : "accuracy isn't sufficient\n");
+   return match;
+}
+
+//upsamples the whole input as interleaved frames of numChannels samples
+template<typename SampleFormat, uint8_t numChannels>
+static int upsampleInterleaved(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   using SRDoublerType = SRDoubler<SampleFormat, numChannels, TABLE_WIDTH>;
+   using FFTDoublerType = CFFTDoubler<SampleFormat, numChannels, TABLE_WIDTH>;
+   using SampleFrame = typename SRDoublerType::SampleFrame;
+   using FrameSpan = typename SRDoublerType::FrameSpan;
+   using FrameVector = typename SRDoublerType::FrameVector;
+
+   options.stats->SetMode("interleaved");
+
+   //samples stored the way they are processed are used right in the mapped file
+   CMappedWaveFile mapped = TimeStage(options.stats, UpsamplerStage::Open, [&]() { return CMappedWaveFile{ options.input }; });
+   SampleFormat * mapped_samples = mapped.Samples<SampleFormat>();
+   std::vector<SampleFrame> input;
+   FrameSpan sine_wave_span;
+   if (mapped_samples && mapped.Channels() == numChannels && mapped.Frames() == static_cast<uint64_t>(info_in.frames))
+   {
+      sine_wave_span = FrameSpan{ reinterpret_cast<SampleFrame *>(mapped_samples), static_cast<typename FrameSpan::index_type>(info_in.frames) };
+      options.stats->Counts().mapped = true;
+      console() << info_in.frames << " audio frames mapped\n";
+   }
+   else
+   {
+      TimeStage(options.stats, UpsamplerStage::Allocate, [&]() { input.resize(static_cast<size_t>(info_in.frames)); });
+      if (TimeStage(options.stats, UpsamplerStage::Read, [&]() { return readFrames(in, &input[0][0], info_in.frames); }) != info_in.frames)
+      {
+         console() << "Failure to read all the expected audio data\n";
+         return -1;
+      }
+      sine_wave_span = FrameSpan{ input };
+      console() << info_in.frames << " audio frames read\n";
+   }
+   std::unique_ptr<FFTDoublerType> fft_doubler;
+   if (options.fft && options.doubling())
+      fft_doubler = TimeStage(options.stats, UpsamplerStage::Design, [&]() { return std::make_unique<FFTDoublerType>(sine_wave_span, getKeiserFilter<SampleFormat>()); });
+
+   if (!options.doubling())
+      printConversion(options, "");
+   else if (fft_doubler && fft_doubler->UsesFFT())
+      console() << "About to start overlap-save upsampling...\n";
+   else
+      console() << "About to start upsampling with a " << options.taps << " tap table and " << SimdLevelName(ActiveSimdLevel()) << " kernels on " << options.threads << " thread(s)...\n";
+
+   using namespace std::chrono;
+
+   steady_clock clock;
+
+   auto t0 = clock.now();
+
+   //upsample the input
+   FrameVector upsampled_signal = TimeStage(options.stats, UpsamplerStage::Upsample, [&]()
+   {
+      return !options.doubling() ? resampleFrames<SampleFormat, numChannels>(sine_wave_span, options)
+           : fft_doubler ? fft_doubler->Run() : doubleFrames<SampleFormat, numChannels>(sine_wave_span, options);
+   });
+
+   auto t1 = clock.now();
+
+   console() << "Upsampling took " << duration_cast<milliseconds_type>(t1 - t0).count() << " milliseconds\n";
+
+   if (options.verify && !verifyAgainstDouble<SampleFormat>(info_in.frames, numChannels, options,
+      [&](size_t c, size_t i) { return sine_wave_span[i][c]; },
+      [&](size_t c, size_t i) { return upsampled_signal[i][c]; }))
+      return -1;
+
+   //save the upsampled signal into an output file
+   sf_count_t frames_out = outputFrames(info_in.frames, options);
+   sf_count_t rc = TimeStage(options.stats, UpsamplerStage::Write, [&]() { return writeFrames(out, &upsampled_signal[0][0], frames_out); });
+   if (rc != frames_out)
+   {
+      console() << "Failure to save upsampled data\n";
+      return -1;
+   }
+
+   console() << frames_out << " audio frames written\n";
+   return 0;
+}
+
+//upsamples the input kept as one buffer per channel, converting at the libsndfile boundary
+template<typename SampleFormat>
+static int upsamplePlanar(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   using PlanarDoublerType = CPlanarDoubler<SampleFormat, TABLE_WIDTH>;
+   using ChannelVector = typename PlanarDoublerType::ChannelVector;
+   using ChannelVectors = typename PlanarDoublerType::ChannelVectors;
+   using ChannelSpans = typename PlanarDoublerType::ChannelSpans;
+
+   options.stats->SetMode("planar");
+
+   const size_t channels = static_cast<size_t>(info_in.channels);
+   std::vector<SampleFormat> block(static_cast<size_t>(IO_BLOCK_FRAMES) * channels);
+   std::vector<SampleFormat *> channel_ptrs(channels);
+
+   //read and deinterleave the input block by block
+   ChannelVectors input = TimeStage(options.stats, UpsamplerStage::Allocate, [&]() { return ChannelVectors(channels, ChannelVector(static_cast<size_t>(info_in.frames))); });
+   {
+      CStageTimer timer{ options.stats, UpsamplerStage::Read };
+      for (sf_count_t frame = 0; frame < info_in.frames; frame += IO_BLOCK_FRAMES)
+      {
+         sf_count_t frames = std::min(IO_BLOCK_FRAMES, info_in.frames - frame);
+         if (readFrames(in, block.data(), frames) != frames)
+         {
+            console() << "Failure to read all the expected audio data\n";
+            return -1;
+         }
+         for (size_t c = 0; c < channels; c++)
+            channel_ptrs[c] = &input[c][static_cast<size_t>(frame)][0];
+         Deinterleave(block.data(), channels, static_cast<size_t>(frames), channel_ptrs.data());
+      }
+   }
+
+   console() << info_in.frames << " audio frames read\n";
+
+   ChannelSpans input_spans(input.begin(), input.end());
+
+   if (!options.doubling())
+      printConversion(options, "planar ");
+   else
+      console() << "About to start planar upsampling with a " << options.taps << " tap table and " << SimdLevelName(ActiveSimdLevel()) << " kernels on " << options.threads << " thread(s)...\n";
+
+   using namespace std::chrono;
+
+   steady_clock clock;
+
+   auto t0 = clock.now();
+
+   //upsample the input
+   ChannelVectors upsampled_signal;
+   {
+      CStageTimer timer{ options.stats, UpsamplerStage::Upsample };
+      if (!options.doubling())
+      {
+         for (const auto& channel : input_spans)
+            upsampled_signal.push_back(resampleFrames<SampleFormat, 1>(channel, options));
+      }
+      else
+         upsampled_signal = doubleChannels<SampleFormat>(input_spans, options);
+   }
+
+   auto t1 = clock.now();
+
+   console() << "Upsampling took " << duration_cast<milliseconds_type>(t1 - t0).count() << " milliseconds\n";
+
+   if (options.verify && !verifyAgainstDouble<SampleFormat>(info_in.frames, channels, options,
+      [&](size_t c, size_t i) { return input[c][i][0]; },
+      [&](size_t c, size_t i) { return upsampled_signal[c][i][0]; }))
+      return -1;
+
+   //interleave and save the upsampled signal block by block
+   sf_count_t frames_out = outputFrames(info_in.frames, options);
+   std::vector<const SampleFormat *> upsampled_ptrs(channels);
+   CStageTimer timer{ options.stats, UpsamplerStage::Write };
+   for (sf_count_t frame = 0; frame < frames_out; frame += IO_BLOCK_FRAMES)
+   {
+      sf_count_t frames = std::min(IO_BLOCK_FRAMES, frames_out - frame);
+      for (size_t c = 0; c < channels; c++)
+         upsampled_ptrs[c] = &upsampled_signal[c][static_cast<size_t>(frame)][0];
+      Interleave(upsampled_ptrs.data(), channels, static_cast<size_t>(frames), block.data());
+      if (writeFrames(out, block.data(), frames) != frames)
+      {
+         console() << "Failure to save upsampled data\n";
+         return -1;
+      }
+   }
+
+   console() << frames_out << " audio frames written\n";
+   return 0;
+}
+
+/* Chunk upsampler
+Upsamples a stream that arrives in blocks with the streaming engine the
+options call for: a streaming doubler, or a partitioned one with --fft, or a
+cascade, or a minimum phase doubler, which has no leading silence. The engines keep the input frames the next block still needs, so
+the output for any blocking is the same as the in-memory path produces for
+the whole file. The leading silence of the doublers is dropped.
+*/
+template<typename SampleFormat, uint8_t numChannels> class CChunkUpsampler
+{
+public:
+   using StreamingDoublerType = CStreamingDoubler<SampleFormat, numChannels, DYNAMIC_TABLE_WIDTH>;
+   using PartitionedDoublerType = CPartitionedDoubler<SampleFormat, numChannels, TABLE_WIDTH>;
+   using MinimumPhaseDoublerType = CMinimumPhaseDoubler<SampleFormat, numChannels, TABLE_WIDTH>;
+   using SampleFrame = typename StreamingDoublerType::SampleFrame;
+   using FrameVector = typename StreamingDoublerType::FrameVector;
+   using size_type = typename StreamingDoublerType::size_type;
+
+   CChunkUpsampler(const SUpsamplerOptions& options)
+   {
+      //cascades drop the leading silence of their stages themselves and the minimum phase doubler has none
+      if (options.minimum_phase)
+         m_minimum_phase = std::make_unique<MinimumPhaseDoublerType>(getMinimumPhaseFilter<SampleFormat>());
+      else if (options.factor == 8)
+         m_cascade8 = std::make_unique<CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 3>>(ALPHA);
+      else if (options.factor == 4)
+         m_cascade4 = std::make_unique<CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 2>>(ALPHA);
+      else if (options.fft)
+      {
+         m_partitioned = std::make_unique<PartitionedDoublerType>(getKeiserFilter<SampleFormat>());
+         m_skip = 2 * m_partitioned->Latency();
+      }
+      else
+      {
+         m_streaming = std::make_unique<StreamingDoublerType>(getKeiserFilter<SampleFormat>(options.taps), options.taps);
+         m_skip = 2 * m_streaming->Latency();
+      }
+   }
+
+   //appends the output for count more input frames to out
+   void Process(const SampleFrame * in, size_type count, FrameVector& out)
+   {
+      if (m_minimum_phase)
+      {
+         size_type first = out.size();
+         out.resize(first + 2 * count);
+         return m_minimum_phase->Process(in, count, out.data() + first);
+      }
+      if (m_cascade8)
+         return m_cascade8->Process(in, count, out);
+      if (m_cascade4)
+         return m_cascade4->Process(in, count, out);
+
+      size_type first = out.size();
+      out.resize(first + 2 * count);
+      if (m_partitioned)
+         m_partitioned->Process(in, count, out.data() + first);
+      else
+         m_streaming->Process(in, count, out.data() + first);
+      dropSilence(out, first);
+   }
+
+   //appends the output for the last input frames to out
+   void Flush(FrameVector& out)
+   {
+      if (m_minimum_phase)
+         return;
+      if (m_cascade8)
+         return m_cascade8->Flush(out);
+      if (m_cascade4)
+         return m_cascade4->Flush(out);
+
+      size_type first = out.size();
+      out.resize(first + 2 * (m_partitioned ? m_partitioned->Latency() : m_streaming->Latency()));
+      if (m_partitioned)
+         m_partitioned->Flush(out.data() + first);
+      else
+         m_streaming->Flush(out.data() + first);
+      dropSilence(out, first);
+   }
+
+private:
+
+   std::unique_ptr<StreamingDoublerType> m_streaming;
+   std::unique_ptr<PartitionedDoublerType> m_partitioned;
+   std::unique_ptr<MinimumPhaseDoublerType> m_minimum_phase;
+   std::unique_ptr<CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 2>> m_cascade4;
+   std::unique_ptr<CCascadeDoubler<SampleFormat, numChannels, TABLE_WIDTH, 3>> m_cascade8;
+   size_type m_skip = 0;   //leading silent frames of a doubler still to be dropped
+
+   void dropSilence(FrameVector& out, size_type first)
+   {
+      size_type skipped = std::min(m_skip, out.size() - first);
+      out.erase(out.begin() + first, out.begin() + first + skipped);
+      m_skip -= skipped;
+   }
+};
+
+/* Chunked upsampling
+Reads, upsamples and writes blocks sized to the memory budget, so that only
+one block of input and its output are held at a time. Every group of
+numChannels channels gets its own chunk upsampler, so a file with a channel
+count there are no interleaved doublers for, or one processed with --planar,
+is upsampled with one mono engine per channel.
+*/
+template<typename SampleFormat, uint8_t numChannels>
+static int upsampleChunked(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   using ChunkUpsamplerType = CChunkUpsampler<SampleFormat, numChannels>;
+   using FrameVector = typename ChunkUpsamplerType::FrameVector;
+
+   const size_t channels = static_cast<size_t>(info_in.channels);
+   const size_t groups = channels / numChannels;
+
+   //a block is held as read, split into groups, upsampled and interleaved again
+   const size_t frame_bytes = channels * sizeof(SampleFormat) * (2 + 2 * options.factor);
+   const sf_count_t block_frames = static_cast<sf_count_t>(std::max<size_t>(1, options.memory / frame_bytes));
+
+   options.stats->SetMode("chunked");
+
+   std::vector<std::unique_ptr<ChunkUpsamplerType>> upsamplers(groups);
+   for (auto& upsampler : upsamplers)
+      upsampler = TimeStage(options.stats, UpsamplerStage::Design, [&]() { return std::make_unique<ChunkUpsamplerType>(options); });
+   std::vector<SampleFormat> block = TimeStage(options.stats, UpsamplerStage::Allocate, [&]() { return std::vector<SampleFormat>(static_cast<size_t>(block_frames) * channels); });
+   std::vector<FrameVector> group_inputs(groups), group_outputs(groups);
+   std::vector<SampleFormat> upsampled;
+
+   console() << "About to start " << ((groups > 1) ? "planar " : "") << "chunked upsampling in blocks of " << block_frames << " frames with "
+        << SimdLevelName(ActiveSimdLevel()) << " kernels...\n";
+
+   //interleaves the output of the groups and writes it
+   sf_count_t frames_out = 0;
+   auto write = [&]()
+   {
+      CStageTimer timer{ options.stats, UpsamplerStage::Write };
+      sf_count_t frames = static_cast<sf_count_t>(group_outputs[0].size());
+      const SampleFormat * samples = &group_outputs[0][0][0];
+      if (groups > 1)
+      {
+         upsampled.resize(static_cast<size_t>(frames) * channels);
+         for (size_t g = 0; g < groups; g++)
+            for (size_t i = 0; i < static_cast<size_t>(frames); i++)
+               std::copy(group_outputs[g][i].begin(), group_outputs[g][i].end(), &upsampled[i * channels + g * numChannels]);
+         samples = upsampled.data();
+      }
+      if (frames && writeFrames(out, samples, frames) != frames)
+         return false;
+      frames_out += frames;
+      for (auto& output : group_outputs)
+         output.clear();
+      return true;
+   };
+
+   using namespace std::chrono;
+
+   steady_clock clock;
+
+   auto t0 = clock.now();
+
+   for (sf_count_t frame = 0; frame < info_in.frames; frame += block_frames)
+   {
+      sf_count_t frames = std::min(block_frames, info_in.frames - frame);
+      if (TimeStage(options.stats, UpsamplerStage::Read, [&]() { return readFrames(in, block.data(), frames); }) != frames)
+      {
+         console() << "Failure to read all the expected audio data\n";
+         return -1;
+      }
+
+      CStageTimer timer{ options.stats, UpsamplerStage::Upsample };
+      for (size_t g = 0; g < groups; g++)
+      {
+         FrameVector& input = group_inputs[g];
+         input.resize(static_cast<size_t>(frames));
+         for (size_t i = 0; i < input.size(); i++)
+            std::copy_n(&block[i * channels + g * numChannels], numChannels, input[i].begin());
+         upsamplers[g]->Process(input.data(), input.size(), group_outputs[g]);
+      }
+
+      if (!write())
+      {
+         console() << "Failure to save upsampled data\n";
+         return -1;
+      }
+   }
+
+   TimeStage(options.stats, UpsamplerStage::Upsample, [&]()
+   {
+      for (size_t g = 0; g < groups; g++)
+         upsamplers[g]->Flush(group_outputs[g]);
+   });
+   if (!write())
+   {
+      console() << "Failure to save upsampled data\n";
+      return -1;
+   }
+
+   auto t1 = clock.now();
+
+   console() << info_in.frames << " audio frames read\n";
+   console() << "Upsampling took " << duration_cast<milliseconds_type>(t1 - t0).count() << " milliseconds\n";
+   console() << frames_out << " audio frames written\n";
+   return 0;
+}
+
+//a block of interleaved samples passed between the stages of the pipeline
+template<typename SampleFormat> struct SSampleBlock
+{
+   size_t index = 0;                      //position of the block in the stream
+   size_t frames = 0;                     //frames the block upsamples, or output frames it holds
+   std::vector<SampleFormat> samples;
+};
+
+/* Pipelined upsampling
+A reader thread, compute workers and a writer thread are connected by bounded
+block queues, so that reading, upsampling and writing overlap and the slowest
+of them sets the pace. When the rate is simply doubled in direct form, every
+input block carries the halfWidth-1 frames before it and the halfWidth frames
+after it, zero outside the file, and is upsampled with SRDoubler::RunInterior()
+on its own; any number of workers can then take blocks and the writer puts
+their output back in order. A worker doesn't start a block more than workers
+blocks after the next one to be written, so a slow block holds the others
+back instead of letting the writer collect everything behind it. Cascades and the partitioned doubler keep state
+between blocks, so they run on a single worker with chunk upsamplers. The
+output is the same as the in-memory path produces.
+*/
+template<typename SampleFormat, uint8_t numChannels>
+static int upsamplePipelined(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   using Block = SSampleBlock<SampleFormat>;
+   using SRDoublerType = SRDoubler<SampleFormat, numChannels, DYNAMIC_TABLE_WIDTH>;
+   using ChunkUpsamplerType = CChunkUpsampler<SampleFormat, numChannels>;
+   using FrameSpan = typename SRDoublerType::FrameSpan;
+   using FrameVector = typename SRDoublerType::FrameVector;
+   using index_type = typename SRDoublerType::index_type;
+
+   const size_t channels = static_cast<size_t>(info_in.channels);
+   const size_t groups = channels / numChannels;
+   const bool independent_blocks = options.doubling() && !options.fft;
+   const unsigned workers = independent_blocks ? std::max(1u, options.threads) : 1;
+   const size_t before = independent_blocks ? options.taps / 2 - 1 : 0;
+   const size_t after = independent_blocks ? options.taps / 2 : 0;
+
+   //every queue holds up to one block per worker, the writer keeps up to workers blocks waiting for their turn,
+   //and the reader, the workers and the writer hold one more each
+   const size_t blocks_in_flight = 4 * workers + 2;
+   const size_t frame_bytes = channels * sizeof(SampleFormat) * (2 + 2 * options.factor);
+   const size_t block_frames = std::max<size_t>(options.taps, options.memory / (blocks_in_flight * frame_bytes));
+
+   options.stats->SetMode("pipelined");
+
+   CBlockQueue<Block> input_queue{ workers }, output_queue{ workers };
+   std::atomic<bool> read_failed{ false }, write_failed{ false };
+   milliseconds_type reading{ 0 }, writing{ 0 };
+   std::vector<milliseconds_type> computing(workers, milliseconds_type{ 0 });
+   sf_count_t frames_out = 0;
+
+   //the index of the next block to be written, which bounds the blocks the workers may start
+   size_t written = 0;
+   std::mutex window_mutex;
+   std::condition_variable window_moved;
+
+   console() << "About to start " << ((groups > 1) ? "planar " : "") << "pipelined upsampling in blocks of " << block_frames << " frames with "
+        << SimdLevelName(ActiveSimdLevel()) << " kernels on " << workers << " thread(s)...\n";
+
+   using namespace std::chrono;
+
+   steady_clock clock;
+
+   auto t0 = clock.now();
+
+   //reads the blocks with their halo; the frames after one block are the first ones of the next
+   std::thread reader{ [&]()
+   {
+      std::vector<SampleFormat> carry((before + after) * channels, SampleFormat{});
+      sf_count_t unread = info_in.frames;
+      auto readPadded = [&](SampleFormat * samples, size_t frames)
+      {
+         auto start = clock.now();
+         sf_count_t count = std::min(static_cast<sf_count_t>(frames), unread);
+         if (count && readFrames(in, samples, count) != count)
+            return false;
+         std::fill(samples + count * channels, samples + frames * channels, SampleFormat{});
+         unread -= count;
+         reading += clock.now() - start;
+         return true;
+      };
+
+      if (!readPadded(carry.data() + before * channels, after))
+         read_failed = true;
+
+      size_t index = 0;
+      for (sf_count_t first = 0; first < info_in.frames && !read_failed; first += block_frames, index++)
+      {
+         Block block;
+         block.index = index;
+         block.frames = static_cast<size_t>(std::min<sf_count_t>(block_frames, info_in.frames - first));
+         block.samples.resize((before + block.frames + after) * channels);
+         std::copy(carry.begin(), carry.end(), block.samples.begin());
+         if (!readPadded(block.samples.data() + carry.size(), block.frames))
+         {
+            read_failed = true;
+            break;
+         }
+         std::copy(block.samples.end() - carry.size(), block.samples.end(), carry.begin());
+         input_queue.Push(std::move(block));
+      }
+      input_queue.Close();
+   } };
+
+   //upsamples every group of the block and interleaves the groups again
+   auto compute = [&](unsigned worker)
+   {
+      const FrameSpan no_input{};
+      std::vector<std::unique_ptr<SRDoublerType>> doublers;
+      std::vector<std::unique_ptr<ChunkUpsamplerType>> upsamplers;
+      for (size_t g = 0; g < groups; g++)
+      {
+         if (independent_blocks)
+            doublers.push_back(std::make_unique<SRDoublerType>(no_input, getKeiserFilter<SampleFormat>(options.taps), options.taps));
+         else
+            upsamplers.push_back(std::make_unique<ChunkUpsamplerType>(options));
+      }
+      std::vector<FrameVector> group_inputs(groups), group_outputs(groups);
+
+      auto interleave = [&](size_t index)
+      {
+         Block block;
+         block.index = index;
+         block.frames = group_outputs[0].size();
+         block.samples.resize(block.frames * channels);
+         for (size_t g = 0; g < groups; g++)
+         {
+            for (size_t i = 0; i < block.frames; i++)
+               std::copy(group_outputs[g][i].begin(), group_outputs[g][i].end(), &block.samples[i * channels + g * numChannels]);
+            group_outputs[g].clear();
+         }
+         return block;
+      };
+
+      Block block;
+      size_t next = 0;
+      while (input_queue.Pop(block))
+      {
+         {
+            std::unique_lock<std::mutex> lock{ window_mutex };
+            window_moved.wait(lock, [&]() { return block.index <= written + workers; });
+         }
+
+         auto start = clock.now();
+         for (size_t g = 0; g < groups; g++)
+         {
+            FrameVector& input = group_inputs[g];
+            input.resize(block.samples.size() / channels);
+            for (size_t i = 0; i < input.size(); i++)
+               std::copy_n(&block.samples[i * channels + g * numChannels], numChannels, input[i].begin());
+
+            if (independent_blocks)
+            {
+               group_outputs[g].resize(2 * block.frames);
+               doublers[g]->RunInterior(input.data() + before, static_cast<index_type>(block.frames), group_outputs[g].data());
+            }
+            else
+               upsamplers[g]->Process(input.data(), input.size(), group_outputs[g]);
+         }
+         Block upsampled = interleave(block.index);
+         next = block.index + 1;
+         computing[worker] += clock.now() - start;
+         output_queue.Push(std::move(upsampled));
+      }
+
+      //the only worker of a stateful pipeline writes the tail of the stream as one more block
+      if (!independent_blocks)
+      {
+         for (size_t g = 0; g < groups; g++)
+            upsamplers[g]->Flush(group_outputs[g]);
+         output_queue.Push(interleave(next));
+      }
+   };
+
+   std::vector<std::thread> computers;
+   for (unsigned worker = 0; worker < workers; worker++)
+      computers.emplace_back(compute, worker);
+
+   //writes the blocks in stream order; after a failure it keeps taking them so that the workers don't stall
+   std::thread writer{ [&]()
+   {
+      std::map<size_t, Block> pending;
+      size_t next = 0;
+      Block block;
+      while (output_queue.Pop(block))
+      {
+         pending.emplace(block.index, std::move(block));
+         for (auto ready = pending.find(next); ready != pending.end(); ready = pending.find(++next))
+         {
+            const Block& upsampled = ready->second;
+            sf_count_t frames = static_cast<sf_count_t>(upsampled.frames);
+            auto start = clock.now();
+            if (!write_failed && frames && writeFrames(out, upsampled.samples.data(), frames) != frames)
+               write_failed = true;
+            writing += clock.now() - start;
+            frames_out += frames;
+            pending.erase(ready);
+
+            std::lock_guard<std::mutex> lock{ window_mutex };
+            written = next + 1;
+            window_moved.notify_all();
+         }
+      }
+   } };
+
+   reader.join();
+   for (std::thread& computer : computers)
+      computer.join();
+   output_queue.Close();
+   writer.join();
+
+   auto t1 = clock.now();
+
+   //the stages ran concurrently, each on its own threads
+   options.stats->Add(UpsamplerStage::Read, reading);
+   options.stats->Add(UpsamplerStage::Upsample, std::accumulate(computing.begin(), computing.end(), milliseconds_type{ 0 }));
+   options.stats->Add(UpsamplerStage::Write, writing);
+
+   if (read_failed)
+   {
+      console() << "Failure to read all the expected audio data\n";
+      return -1;
    }
+   if (write_failed)
+   {
+      console() << "Failure to save upsampled data\n";
+      return -1;
+   }
+
+   console() << info_in.frames << " audio frames read\n";
+   console() << "Reading took " << reading.count() << ", upsampling " << std::max_element(computing.begin(), computing.end())->count()
+        << " and writing " << writing.count() << " milliseconds\n";
+   console() << "The pipeline took " << duration_cast<milliseconds_type>(t1 - t0).count() << " milliseconds\n";
+   console() << frames_out << " audio frames written\n";
+   return 0;
+}
+
+//upsamples the file block by block, either on one thread or pipelined
+template<typename SampleFormat, uint8_t numChannels>
+static int upsampleBlocks(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   return options.pipeline ? upsamplePipelined<SampleFormat, numChannels>(in, info_in, out, options) : upsampleChunked<SampleFormat, numChannels>(in, info_in, out, options);
+}
+
+//interleaved doublers are instantiated for the common channel counts; any other count is processed planar
+template<typename SampleFormat>
+static int upsample(SNDFILE * in, const SF_INFO& info_in, SNDFILE * out, const SUpsamplerOptions& options)
+{
+   options.stats->SetFormat(sampleFormatName<SampleFormat>());
+   TimeStage(options.stats, UpsamplerStage::Design, [&]() { return getKeiserFilter<SampleFormat>(options.taps); });
+
+   const bool chunked = options.memory != 0;
+   if (!options.planar)
+   {
+      switch (info_in.channels)
+      {
+      case 1: return chunked ? upsampleBlocks<SampleFormat, 1>(in, info_in, out, options) : upsampleInterleaved<SampleFormat, 1>(in, info_in, out, options);
+      case 2: return chunked ? upsampleBlocks<SampleFormat, 2>(in, info_in, out, options) : upsampleInterleaved<SampleFormat, 2>(in, info_in, out, options);
+      case 4: return chunked ? upsampleBlocks<SampleFormat, 4>(in, info_in, out, options) : upsampleInterleaved<SampleFormat, 4>(in, info_in, out, options);
+      case 6: return chunked ? upsampleBlocks<SampleFormat, 6>(in, info_in, out, options) : upsampleInterleaved<SampleFormat, 6>(in, info_in, out, options);
+      case 8: return chunked ? upsampleBlocks<SampleFormat, 8>(in, info_in, out, options) : upsampleInterleaved<SampleFormat, 8>(in, info_in, out, options);
+      default:
+         console() << "There is no interleaved doubler for " << info_in.channels << " channels, switching to the planar mode\n";
+         break;
+      }
+   }
+   return chunked ? upsampleBlocks<SampleFormat, 1>(in, info_in, out, options) : upsamplePlanar<SampleFormat>(in, info_in, out, options);
+}
 
-   using SRDoublerType = SRDoubler<double, 2, TABLE_WIDTH>;
-   using SampleFrame = SRDoublerType::SampleFrame;
-   using FrameSpan = SRDoublerType::FrameSpan;
-   using FrameVector = SRDoublerType::FrameVector;
+static void printUsage()
+{
+   console() << "Usage: SrDoubler [options] <input file> <output file>\n";
+   console() << "       SrDoubler --batch [options] <input file, directory or @list file>... <output directory>\n";
+   console() << "  --planar   process every channel as a separate contiguous buffer\n";
+   console() << "  --float    process 32 bit floating point samples instead of 64 bit ones\n";
+   console() << "  --integer  process 8 and 16 bit PCM as 16 bit integers and 24 and 32 bit PCM as 32 bit ones\n";
+   console() << "  --verify   check that the result is within -120db of an independent direct convolution in double\n";
+   console() << "             precision, or of the double precision path for --factor 4 or 8, --rate and --minimum-phase\n";
+   console() << "  --fft      convolve with an overlap-save FFT engine (interleaved mode only)\n";
+   console() << "  --threads <n>  run the direct form convolution on n threads, 0 for one per core\n";
+   console() << "  --factor <n>   multiply the sampling rate by 2, 4 or 8; 4 and 8 use a cascade of doublers\n";
+   console() << "  --rate <hz>    convert to any sampling rate, with a polyphase resampler unless it is 2, 4 or 8 times the input one\n";
+   console() << "  --memory <mb>  read, upsample and write the file in blocks that fit into this many megabytes\n";
+   console() << "  --pipeline     read, upsample and write blocks concurrently, upsampling on --threads threads\n";
+   console() << "  --taps <n>     double with a filter table of n taps, an even number from 4 to 65536, 3200 by default\n";
+   console() << "  --quality <q>  draft, low, medium, high or maximum: 64, 256, 1024, 3200 or 8192 taps\n";
+   console() << "  --minimum-phase  double with a minimum phase filter, which delays the output by a few frames instead of 1600\n";
+   console() << "  --jobs <n>     convert n files of a batch at a time, one per core by default\n";
+   console() << "  --stats <file> write the time of every stage and the work done for every file as JSON\n";
+   console() << "Files with 1, 2, 4, 6 or 8 channels are processed interleaved unless --planar is given, others always planar\n";
+}
 
+//opens the files and converts one into the other; the options are adjusted to its format and sampling rate
+static int openAndConvert(const char * input_path, const char * output_path, SUpsamplerOptions options)
+{
    //open input file
    SF_INFO info_in{ 0 };
-   SNDFILE * in = sf_open(argv[1], SFM_READ, &info_in);
+   SNDFILE * in = TimeStage(options.stats, UpsamplerStage::Open, [&]() { return sf_open(input_path, SFM_READ, &info_in); });
+   options.input = input_path;
    if (!in)
    {
-      cout << "Failure to open an input file\n";
+      console() << "Failure to open an input file\n";
       return -1;
    }
-   if (info_in.channels != 2)
+
+   //the integer path keeps the samples at their own width, 24 bit ones left justified in 32 bits
+   bool wide_integers = false;
+   if (options.integer)
+   {
+      switch (info_in.format & SF_FORMAT_SUBMASK)
+      {
+      case SF_FORMAT_PCM_S8:
+      case SF_FORMAT_PCM_U8:
+      case SF_FORMAT_PCM_16:
+         break;
+      case SF_FORMAT_PCM_24:
+      case SF_FORMAT_PCM_32:
+         wide_integers = true;
+         break;
+      default:
+         sf_close(in);
+         console() << "--integer needs a PCM input file\n";
+         return -1;
+      }
+   }
+
+   //open output file
+   SF_INFO info_out{ info_in };
+   if (options.rate)
+   {
+      //a ratio of 2, 4 or 8 is still handled by the doublers
+      size_t divisor = std::gcd<size_t>(options.rate, info_in.samplerate);
+      size_t up = options.rate / divisor, down = info_in.samplerate / divisor;
+      if (down == 1 && (up == 2 || up == 4 || up == 8))
+         options.factor = static_cast<unsigned>(up);
+      else if (up > MAX_POLYPHASE_PHASES)
+      {
+         sf_close(in);
+         console() << "Converting " << info_in.samplerate << " to " << options.rate << " takes a ratio of " << up << "/" << down
+                   << ", the polyphase resampler only supports reduced ratios whose numerator is at most " << MAX_POLYPHASE_PHASES << "\n";
+         return -1;
+      }
+      else if (CPolyphaseResampler<double, 1, TABLE_WIDTH>::PhaseWidth(up, down) > MAX_POLYPHASE_WIDTH)
+      {
+         sf_close(in);
+         console() << "Converting " << info_in.samplerate << " to " << options.rate << " takes a ratio of " << up << "/" << down
+                   << ", the polyphase resampler only supports ratios whose tables are at most " << MAX_POLYPHASE_WIDTH << " frames wide\n";
+         return -1;
+      }
+      else
+      {
+         options.up = up;
+         options.down = down;
+         if (options.memory)
+         {
+            console() << "The polyphase resampler needs the whole file in memory, ignoring --memory and --pipeline\n";
+            options.memory = 0;
+            options.pipeline = false;
+         }
+      }
+      info_out.samplerate = options.rate;
+   }
+   else
+      info_out.samplerate *= options.factor;
+
+   if (options.taps != TABLE_WIDTH && (options.up || options.factor != 2))
    {
       sf_close(in);
-      cout << "SRDoubler can process only stereo files\n";
+      console() << "--taps and --quality only apply to doubling in direct form\n";
       return -1;
    }
 
-   std::vector<SampleFrame> input{ static_cast<size_t>(info_in.frames) };
-   sf_count_t rc = sf_readf_double(in, &input[0][0], info_in.frames);
-   if (rc != info_in.frames)
+   SNDFILE * out = TimeStage(options.stats, UpsamplerStage::Open, [&]() { return sf_open(output_path, SFM_WRITE, &info_out); });
+   if (!out)
    {
       sf_close(in);
-      cout << "Failure to read all the expected audio data\n";
+      console() << "Failure to open an output file\n";
       return -1;
    }
 
-   cout << info_in.frames << " audio frames read\n";
+   SUpsamplerCounts& counts = options.stats->Counts();
+   counts.channels = info_in.channels;
+   counts.input_frames = info_in.frames;
+   counts.output_frames = outputFrames(info_in.frames, options);
+   counts.macs = filterMacs(info_in.frames, info_in.channels, options);
 
-   FrameSpan sine_wave_span{ input };
-   SRDoublerType doubler{ sine_wave_span ,KEISER_FILTER };
+   int rc;
+   if (options.integer)
+      rc = wide_integers ? upsample<int32_t>(in, info_in, out, options) : upsample<int16_t>(in, info_in, out, options);
+   else
+      rc = options.use_float ? upsample<float>(in, info_in, out, options) : upsample<double>(in, info_in, out, options);
 
-   cout << "About to start upsampling...\n";
+   CStageTimer timer{ options.stats, UpsamplerStage::Close };
+   sf_close(out);
+   sf_close(in);
+   return rc;
+}
+
+//converts one file, collecting its statistics into stats
+static int convertFile(const char * input_path, const char * output_path, SUpsamplerOptions options, CUpsamplerStats& stats)
+{
+   options.stats = &stats;
+   stats.SetFiles(input_path, output_path);
+
+   auto t0 = CUpsamplerStats::clock_type::now();
+   int rc = openAndConvert(input_path, output_path, options);
+   auto t1 = CUpsamplerStats::clock_type::now();
+
+   std::error_code error;
+   uintmax_t bytes = std::filesystem::file_size(input_path, error);
+   stats.Counts().input_bytes = error ? 0 : bytes;
+   bytes = std::filesystem::file_size(output_path, error);
+   stats.Counts().output_bytes = error ? 0 : bytes;
+   stats.SetResult(rc == 0, t1 - t0);
+   return rc;
+}
+
+//writes the statistics report of the run to path
+static bool writeStats(const char * path, const std::vector<const CUpsamplerStats *>& files, unsigned jobs, double wall_milliseconds)
+{
+   std::ofstream out{ path };
+   WriteStatsReport(out, files, SimdLevelName(ActiveSimdLevel()), jobs, wall_milliseconds);
+   out.close();
+   if (!out)
+   {
+      console() << "Failure to write the statistics file " << path << "\n";
+      return false;
+   }
+   return true;
+}
+
+/* Batch conversion
+The inputs of a batch are audio files, directories, whose audio files are
+converted with their relative paths kept, and list files given as @path with
+one input per line. The output files get the names of the input ones in the
+output directory, and a batch in which two inputs would be written to the
+same output is rejected before anything is converted. Files are converted by
+a pool of jobs threads, largest first, so that the long files don't end up
+running alone at the end; all of them share the filter tables
+getKeiserFilter() builds once per process. The messages of every file are
+printed together when it is done.
+*/
+
+struct SBatchFile
+{
+   std::filesystem::path input;
+   std::filesystem::path output;
+   sf_count_t frames;         //input frames
+   int channels;
+   uintmax_t bytes;           //size of the input file
+};
+
+//adds the input to the batch if libsndfile can read it
+static void addBatchFile(const std::filesystem::path& input, const std::filesystem::path& output, std::vector<SBatchFile>& batch)
+{
+   SF_INFO info{};
+   SNDFILE * file = sf_open(input.string().c_str(), SFM_READ, &info);
+   if (!file)
+      return;
+   sf_close(file);
+
+   std::error_code error;
+   uintmax_t bytes = std::filesystem::file_size(input, error);
+   batch.push_back(SBatchFile{ input, output, info.frames, info.channels, error ? 0 : bytes });
+}
+
+static int runBatch(const std::vector<const char *>& arguments, const SUpsamplerOptions& options, unsigned jobs, const char * stats_path)
+{
+   namespace fs = std::filesystem;
+
+   const fs::path output_directory{ arguments.back() };
+   std::vector<SBatchFile> batch;
+   std::error_code error;
+
+   for (size_t a = 0; a + 1 < arguments.size(); a++)
+   {
+      const char * argument = arguments[a];
+      if (argument[0] == '@')
+      {
+         std::ifstream list{ argument + 1 };
+         if (!list)
+         {
+            console() << "Failure to open the list file " << argument + 1 << "\n";
+            return -1;
+         }
+         for (std::string line; std::getline(list, line);)
+         {
+            if (!line.empty() && line.back() == '\r')
+               line.pop_back();
+            if (!line.empty())
+               addBatchFile(line, output_directory / fs::path{ line }.filename(), batch);
+         }
+      }
+      else if (fs::is_directory(argument, error))
+      {
+         for (const auto& entry : fs::recursive_directory_iterator{ argument, error })
+         {
+            if (entry.is_regular_file(error))
+               addBatchFile(entry.path(), output_directory / fs::relative(entry.path(), argument, error), batch);
+         }
+      }
+      else
+         addBatchFile(argument, output_directory / fs::path{ argument }.filename(), batch);
+   }
+
+   if (batch.empty())
+   {
+      console() << "There are no audio files to convert\n";
+      return -1;
+   }
+
+   //inputs with the same name from different directories would overwrite each other's output
+   std::map<std::string, const SBatchFile *> outputs;
+   bool collisions = false;
+   for (const SBatchFile& file : batch)
+   {
+      auto inserted = outputs.emplace(file.output.lexically_normal().string(), &file);
+      if (!inserted.second)
+      {
+         console() << inserted.first->second->input.string() << " and " << file.input.string() << " would both be written to " << file.output.string() << "\n";
+         collisions = true;
+      }
+   }
+   if (collisions)
+      return -1;
+
+   std::sort(batch.begin(), batch.end(), [](const SBatchFile& a, const SBatchFile& b) { return a.frames * a.channels > b.frames * b.channels; });
+
+   jobs = std::min<unsigned>(jobs, static_cast<unsigned>(batch.size()));
+   console() << "About to convert " << batch.size() << " files with " << jobs << " job(s)...\n";
+
+   std::vector<CUpsamplerStats> file_stats(batch.size());
+   std::vector<char> converted(batch.size(), false);   //not vector<bool>, the jobs write its elements concurrently
+   std::atomic<size_t> next{ 0 };
+   std::atomic<size_t> failures{ 0 };
+   std::mutex console_mutex;
+
+   auto job = [&]()
+   {
+      std::ostringstream report;
+      t_console = &report;
+      for (size_t f = next++; f < batch.size(); f = next++)
+      {
+         const SBatchFile& file = batch[f];
+         report.str("");
+         std::error_code directory_error;
+         fs::create_directories(file.output.parent_path(), directory_error);
+         int rc = -1;
+         if (directory_error)
+            report << "Failure to create the output directory " << file.output.parent_path().string() << ": " << directory_error.message() << "\n";
+         else
+            rc = convertFile(file.input.string().c_str(), file.output.string().c_str(), options, file_stats[f]);
+         if (rc != 0)
+            failures++;
+         else
+            converted[f] = true;
+
+         std::lock_guard<std::mutex> lock{ console_mutex };
+         std::cout << file.input.string() << " -> " << file.output.string() << ((rc != 0) ? " FAILED" : "") << "\n" << report.str();
+      }
+   };
 
    using namespace std::chrono;
 
@@ -79,33 +1273,176 @@ int main(int argc, char ** argv)
 
    auto t0 = clock.now();
 
-   //upsample the input
-   FrameVector upsampled_signal = doubler.Run();
+   std::vector<std::thread> workers;
+   for (unsigned j = 0; j < jobs; j++)
+      workers.emplace_back(job);
+   for (std::thread& worker : workers)
+      worker.join();
 
    auto t1 = clock.now();
 
-   auto time_diff = t1 - t0;
+   double seconds = duration_cast<duration<double>>(t1 - t0).count();
+   //the throughput is that of the files actually converted
+   uintmax_t frames = 0, bytes = 0;
+   for (size_t f = 0; f < batch.size(); f++)
+   {
+      if (converted[f])
+      {
+         frames += batch[f].frames;
+         bytes += batch[f].bytes;
+      }
+   }
 
-   using milliseconds_type = duration<double, std::milli>;
+   console() << batch.size() - failures << " of " << batch.size() << " files converted in " << seconds << " seconds\n";
+   console() << frames / seconds << " frames/s, " << bytes / seconds / (1 << 20) << " MB/s of input\n";
 
-   cout << "Upsampling took " << duration_cast<milliseconds_type>(time_diff).count() << " milliseconds\n";
+   if (stats_path)
+   {
+      std::vector<const CUpsamplerStats *> files;
+      for (const CUpsamplerStats& stats : file_stats)
+         files.push_back(&stats);
+      if (!writeStats(stats_path, files, jobs, seconds * 1E3))
+         return -1;
+   }
+   return failures ? -1 : 0;
+}
 
-   //save the upsampled signal into an output file
-   SF_INFO info_out{ info_in };
-   info_out.samplerate *= 2;
-   SNDFILE * out = sf_open(argv[2], SFM_WRITE, &info_out);
-   info_out.frames = info_in.frames * 2;
+int main(int argc, char ** argv)
+{
+   SUpsamplerOptions options;
+   std::vector<const char *> files;
+   bool batch = false;
+   const char * stats_path = nullptr;
+   unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+   for (int i = 1; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "--batch"))
+         batch = true;
+      else if (!strcmp(argv[i], "--jobs") && i + 1 < argc)
+      {
+         int count = atoi(argv[++i]);
+         jobs = (count > 0) ? count : std::max(1u, std::thread::hardware_concurrency());
+      }
+      else if (!strcmp(argv[i], "--stats") && i + 1 < argc)
+         stats_path = argv[++i];
+      else if (!strcmp(argv[i], "--planar"))
+         options.planar = true;
+      else if (!strcmp(argv[i], "--float"))
+         options.use_float = true;
+      else if (!strcmp(argv[i], "--integer"))
+         options.integer = true;
+      else if (!strcmp(argv[i], "--verify"))
+         options.verify = true;
+      else if (!strcmp(argv[i], "--fft"))
+         options.fft = true;
+      else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+      {
+         int threads = atoi(argv[++i]);
+         options.threads = (threads > 0) ? threads : std::max(1u, std::thread::hardware_concurrency());
+      }
+      else if (!strcmp(argv[i], "--factor") && i + 1 < argc)
+      {
+         options.factor = atoi(argv[++i]);
+         if (options.factor != 2 && options.factor != 4 && options.factor != 8)
+         {
+            console() << "The factor should be 2, 4 or 8\n";
+            return -1;
+         }
+      }
+      else if (!strcmp(argv[i], "--memory") && i + 1 < argc)
+      {
+         int megabytes = atoi(argv[++i]);
+         if (megabytes <= 0)
+         {
+            console() << "The memory budget should be a positive number of megabytes\n";
+            return -1;
+         }
+         options.memory = size_t(megabytes) << 20;
+      }
+      else if (!strcmp(argv[i], "--pipeline"))
+         options.pipeline = true;
+      else if (!strcmp(argv[i], "--minimum-phase"))
+         options.minimum_phase = true;
+      else if (!strcmp(argv[i], "--taps") && i + 1 < argc)
+      {
+         int taps = atoi(argv[++i]);
+         if (taps < int(MIN_TAPS) || taps > int(MAX_TAPS) || taps % 2 != 0)
+         {
+            console() << "The number of taps should be an even number from " << MIN_TAPS << " to " << MAX_TAPS << "\n";
+            return -1;
+         }
+         options.taps = taps;
+      }
+      else if (!strcmp(argv[i], "--quality") && i + 1 < argc)
+      {
+         const char * quality = argv[++i];
+         auto preset = std::find_if(std::begin(QUALITY_PRESETS), std::end(QUALITY_PRESETS), [quality](const SQualityPreset& p) { return !strcmp(p.name, quality); });
+         if (preset == std::end(QUALITY_PRESETS))
+         {
+            console() << "The quality should be draft, low, medium, high or maximum\n";
+            return -1;
+         }
+         options.taps = preset->taps;
+      }
+      else if (!strcmp(argv[i], "--rate") && i + 1 < argc)
+      {
+         options.rate = atoi(argv[++i]);
+         if (options.rate <= 0)
+         {
+            console() << "The rate should be positive\n";
+            return -1;
+         }
+      }
+      else if (!strncmp(argv[i], "--", 2))
+      {
+         console() << "Unknown option " << argv[i] << "\n";
+         printUsage();
+         return -1;
+      }
+      else
+         files.push_back(argv[i]);
+   }
 
-   rc = sf_writef_double(out, &upsampled_signal[0][0], info_out.frames);
-   sf_close(out);
-   if (rc != info_out.frames)
+   if (files.size() != 2 && !(batch && files.size() >= 2))
    {
-      cout << "Failure to save upsampled data\n";
+      printUsage();
+      return 0;
+   }
+
+   if (options.use_float && options.integer)
+   {
+      console() << "--float and --integer can't be combined\n";
       return -1;
    }
-   else
+
+   if (options.minimum_phase && (options.factor != 2 || options.rate || options.fft))
    {
-      cout << info_out.frames << " audio frames written\n";
+      console() << "--minimum-phase only doubles the rate, in direct form\n";
+      return -1;
    }
-   return 0;
+
+   //a --rate is checked once the ratio to the rate of the file is known
+   if (options.taps != TABLE_WIDTH && (options.factor != 2 || options.fft || options.minimum_phase))
+   {
+      console() << "--taps and --quality only apply to doubling in direct form\n";
+      return -1;
+   }
+
+   if ((options.memory || options.pipeline) && options.verify)
+   {
+      console() << "--verify needs the whole file in memory and can't be combined with " << (options.memory ? "--memory" : "--pipeline") << "\n";
+      return -1;
+   }
+
+   if (options.pipeline && !options.memory)
+      options.memory = PIPELINE_MEMORY;
+
+   if (batch)
+      return runBatch(files, options, jobs, stats_path);
+
+   CUpsamplerStats stats;
+   int rc = convertFile(files[0], files[1], options, stats);
+   if (stats_path && !writeStats(stats_path, { &stats }, 1, stats.WallMilliseconds()))
+      return -1;
+   return rc;
 }
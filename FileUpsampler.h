@@ -17,12 +17,20 @@ THE SOFTWARE.
 
 */
 
+#pragma once
+
 #include <gsl\span>
 #include <vector>
 #include <array>
 #include <cmath>
 #include <algorithm>
 #include <stdexcept>
+#include <memory>
+#include <type_traits>
+#include <thread>
+#include <cstdint>
+#include <limits>
+#include "SimdKernels.h"
 
  double PI = 3.14159265358979323846264338327950288L;
 /* Functions necessary for the KEISER_FILTER */
@@ -49,28 +57,38 @@ inline double I0(double z)
    return I0_sum;
 }
 
-//Keiser window function for a floating point argument
-inline double Kaiser(double x, double alpha)
+//Keiser window function for a floating point argument; tables pass I0(alpha) so that it is only calculated once
+inline double Kaiser(double x, double alpha, double I0_alpha)
 {
    if (x < 0.)
       return 1.;
    else if (x > 1.)
       return 0.;
    else
-      return I0(alpha*sqrt(1. - x * x)) / I0(alpha);
+      return I0(alpha*sqrt(1. - x * x)) / I0_alpha;
+}
+
+inline double Kaiser(double x, double alpha)
+{
+   return Kaiser(x, alpha, I0(alpha));
 }
 
 
 //A standard Keiser function goes from 1 to 0 when its argument goes from 0 to 1
 //The mapped function does this when its argument goes from n0 to n1 
-inline double KaiserMappedOverIntegerRange(double x, double alpha, size_t n0, size_t n1)
+inline double KaiserMappedOverIntegerRange(double x, double alpha, double I0_alpha, size_t n0, size_t n1)
 {
    if (n0 != n1)
-      return Kaiser((x - n0) / (n1 - n0), alpha);
+      return Kaiser((x - n0) / (n1 - n0), alpha, I0_alpha);
    else
       throw std::runtime_error("Wrong KaiserMappedOverIntegerRange params");
 }
 
+inline double KaiserMappedOverIntegerRange(double x, double alpha, size_t n0, size_t n1)
+{
+   return KaiserMappedOverIntegerRange(x, alpha, I0(alpha), n0, n1);
+}
+
 inline double sinc(double x)
 {
    if (x == 0.)
@@ -79,6 +97,51 @@ inline double sinc(double x)
       return sin(PI*x) / (PI*x);
 }
 
+/* Coefficient and sample conversions
+Floating point coefficients are stored as they are, integer ones in the fixed
+point format the kernels expect. Integer samples are rounded to the nearest
+integer and saturated rather than truncated and wrapped around.
+*/
+
+template<typename CoefficientFormat> inline CoefficientFormat QuantizeCoefficient(double coefficient)
+{
+   if constexpr (std::is_integral<CoefficientFormat>::value)
+      return static_cast<CoefficientFormat>(std::llround(std::ldexp(coefficient, FIXED_POINT_BITS)));
+   else
+      return static_cast<CoefficientFormat>(coefficient);
+}
+
+template<typename CoefficientFormat> inline double CoefficientValue(CoefficientFormat coefficient)
+{
+   if constexpr (std::is_integral<CoefficientFormat>::value)
+      return std::ldexp(double(coefficient), -FIXED_POINT_BITS);
+   else
+      return double(coefficient);
+}
+
+//converts a floating point value or a fixed point accumulator to a sample
+template<typename SampleFormat, typename ValueFormat> inline SampleFormat ToSample(ValueFormat value)
+{
+   if constexpr (!std::is_integral<SampleFormat>::value)
+   {
+      return static_cast<SampleFormat>(value);
+   }
+   else if constexpr (std::is_integral<ValueFormat>::value)
+   {
+      //the arithmetic shift rounds halves up
+      int64_t rounded = (value + (int64_t(1) << (FIXED_POINT_BITS - 1))) >> FIXED_POINT_BITS;
+      rounded = std::max<int64_t>(rounded, std::numeric_limits<SampleFormat>::min());
+      rounded = std::min<int64_t>(rounded, std::numeric_limits<SampleFormat>::max());
+      return static_cast<SampleFormat>(rounded);
+   }
+   else
+   {
+      double clamped = std::max<double>(value, std::numeric_limits<SampleFormat>::min());
+      clamped = std::min<double>(clamped, std::numeric_limits<SampleFormat>::max());
+      return static_cast<SampleFormat>(std::llround(clamped));
+   }
+}
+
 /* Keiser window filter
 The class allocates a 16-byte aligned double array and fills
 it with the values of a Keiser window function mapped over the range
@@ -94,122 +157,383 @@ public:
    {
       static_assert(table_width % 2 == 0, "Table_width should be an even number");
       size_t halfWidth = table_width / 2;
+      const double I0_alpha = I0(alpha);
 
       //calculate the coefficients
       for (size_t i = 0; i < table_width; i++)
       {
          size_t dist = (i < halfWidth) ? (halfWidth - i - 1) : (i - halfWidth);
-         array_type::at(i) = KaiserMappedOverIntegerRange(dist + 0.5, alpha, 0, halfWidth + 1)*sinc(dist + 0.5);
+         array_type::at(i) = KaiserMappedOverIntegerRange(dist + 0.5, alpha, I0_alpha, 0, halfWidth + 1)*sinc(dist + 0.5);
       };
    }
 };
 
-template<typename SampleFormat, uint8_t numChannels, size_t table_width> class SRDoubler
+/* Half-size Keiser window filter
+CFilter is symmetric: its coefficients i and table_width-1-i are equal.
+This class keeps only halfWidth of them, ordered by the distance from
+the interpolated point, so that element dist holds the coefficient for
+the input frames dist+0.5 sample periods away from it. The coefficients
+are always calculated in double precision and then stored in
+CoefficientFormat.
+*/
+
+template <size_t table_width, typename CoefficientFormat = double> class CHalfFilter : public std::array<CoefficientFormat, table_width / 2>
 {
 public:
-   using Array = std::array<SampleFormat, numChannels>;
-   struct SampleFrame : public Array
+   using array_type = std::array <CoefficientFormat, table_width / 2>;
+   CHalfFilter(double alpha) : array_type()
    {
-      using typename Array::size_type;
-      using Array::size;
-      using Array::at;
+      static_assert(table_width % 2 == 0, "Table_width should be an even number");
+      size_t halfWidth = table_width / 2;
+      const double I0_alpha = I0(alpha);
 
-       SampleFrame() : Array()
+      //calculate the coefficients
+      for (size_t dist = 0; dist < halfWidth; dist++)
       {
-      }
+         array_type::at(dist) = QuantizeCoefficient<CoefficientFormat>(KaiserMappedOverIntegerRange(dist + 0.5, alpha, I0_alpha, 0, halfWidth + 1)*sinc(dist + 0.5));
+      };
+   }
 
-       SampleFrame operator* (const double factor) const
-      {
-         SampleFrame outFrame;
+   CHalfFilter(const CFilter<table_width>& filter) : array_type()
+   {
+      //the upper half of a full table is already ordered by distance
+      std::transform(filter.begin() + table_width / 2, filter.end(), array_type::begin(), QuantizeCoefficient<CoefficientFormat>);
+   }
 
-         for (size_type index = 0; index < size(); index++)
-            outFrame[index] = at(index)*factor;
+   template<typename OtherFormat> CHalfFilter(const CHalfFilter<table_width, OtherFormat>& filter) : array_type()
+   {
+      std::transform(filter.begin(), filter.end(), array_type::begin(), [](OtherFormat c) { return QuantizeCoefficient<CoefficientFormat>(CoefficientValue(c)); });
+   }
+};
 
-         return outFrame;
-      }
+//a frame of samples, one per channel; doublers of all table widths share it
+template<typename SampleFormat, uint8_t numChannels> struct SSampleFrame : public std::array<SampleFormat, numChannels>
+{
+   using Array = std::array<SampleFormat, numChannels>;
+   using typename Array::size_type;
+   using Array::size;
+   using Array::at;
 
-       SampleFrame& operator+= (const SampleFrame& frame)
-      {
-         for (size_type index = 0; index < size(); index++)
-            at(index) += frame[index];
+    SSampleFrame() : Array()
+   {
+   }
 
-         return *this;
-      }
-   };
+    SSampleFrame operator* (const double factor) const
+   {
+      SSampleFrame outFrame;
+
+      for (size_type index = 0; index < size(); index++)
+         outFrame[index] = at(index)*factor;
+
+      return outFrame;
+   }
+
+    SSampleFrame& operator+= (const SSampleFrame& frame)
+   {
+      for (size_type index = 0; index < size(); index++)
+         at(index) += frame[index];
+
+      return *this;
+   }
+
+    SSampleFrame operator+ (const SSampleFrame& frame) const
+   {
+      SSampleFrame outFrame{ *this };
+
+      return outFrame += frame;
+   }
+};
+
+/* Table widths
+A doubler whose table_width is DYNAMIC_TABLE_WIDTH gets its width at run
+time, when it is constructed, and runs the same kernels as one compiled for
+a width, which take the number of coefficients as an argument.
+DispatchTableWidth() calls function with std::integral_constant<size_t, width>
+if width is one of STANDARD_TABLE_WIDTHS, which are instantiated in advance,
+and with DYNAMIC_TABLE_WIDTH otherwise, so that the code written for either
+case is the same.
+*/
+
+const size_t DYNAMIC_TABLE_WIDTH = 0;
+const size_t STANDARD_TABLE_WIDTHS[] = { 64, 256, 1024, 3200, 8192 };
+
+template<typename Function> inline auto DispatchTableWidth(size_t width, Function function)
+{
+   switch (width)
+   {
+   case 64: return function(std::integral_constant<size_t, 64>{});
+   case 256: return function(std::integral_constant<size_t, 256>{});
+   case 1024: return function(std::integral_constant<size_t, 1024>{});
+   case 3200: return function(std::integral_constant<size_t, 3200>{});
+   case 8192: return function(std::integral_constant<size_t, 8192>{});
+   default: return function(std::integral_constant<size_t, DYNAMIC_TABLE_WIDTH>{});
+   }
+}
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class SRDoubler
+{
+public:
+   using Array = std::array<SampleFormat, numChannels>;
+   using SampleFrame = SSampleFrame<SampleFormat, numChannels>;
    using FrameSpan = gsl::span<SampleFrame>;
    using FrameVector = std::vector<SampleFrame>;
+   //float samples are filtered with float coefficients, integer ones with fixed point ones, everything else with double ones
+   using CoefficientFormat = typename std::conditional<std::is_same<SampleFormat, float>::value, float,
+                             typename std::conditional<std::is_integral<SampleFormat>::value, int32_t, double>::type>::type;
    using KeiserFilterType = CFilter<table_width>;
+   using HalfFilterType = CHalfFilter<table_width, CoefficientFormat>;
+   static_assert(sizeof(SampleFrame) == sizeof(Array), "Sample frames should be packed contiguously");
    using size_type = typename FrameVector::size_type;
    using index_type = typename FrameSpan::index_type;
 
-    SRDoubler(const FrameSpan& in_span, const KeiserFilterType& filter) : m_in_span{ in_span }, m_filter{ filter }
+    SRDoubler(const FrameSpan& in_span, const KeiserFilterType& filter) : m_in_span{ in_span }, m_coefficients{ adoptCoefficients(filter.data() + table_width / 2) }
    {
+      static_assert(table_width != DYNAMIC_TABLE_WIDTH, "A doubler of a dynamic width needs the width");
    }
 
-private:
+    template<typename OtherFormat>
+    SRDoubler(const FrameSpan& in_span, const CHalfFilter<table_width, OtherFormat>& filter) : m_in_span{ in_span }, m_coefficients{ adoptCoefficients(filter.data()) }
+   {
+      static_assert(table_width != DYNAMIC_TABLE_WIDTH, "A doubler of a dynamic width needs the width");
+   }
 
-   const FrameSpan& m_in_span;
-   const KeiserFilterType& m_filter;
+    //coefficients should point to halfWidth values ordered by distance, like those of CHalfFilter
+    SRDoubler(const FrameSpan& in_span, const CoefficientFormat * coefficients) : m_in_span{ in_span }, m_coefficients{ coefficients }
+   {
+      static_assert(table_width != DYNAMIC_TABLE_WIDTH, "A doubler of a dynamic width needs the width");
+   }
 
-   const int halfWidth = table_width / 2;
+    //the width is given at run time, and should be table_width unless that is DYNAMIC_TABLE_WIDTH
+    SRDoubler(const FrameSpan& in_span, const CoefficientFormat * coefficients, size_t width) : m_in_span{ in_span }, m_coefficients{ coefficients }, halfWidth{ static_cast<int>(width / 2) }
+   {
+      if (width < 2 || width % 2 != 0 || (table_width != DYNAMIC_TABLE_WIDTH && width != table_width))
+         throw std::runtime_error("Wrong table width");
+   }
 
-   SampleFrame m_null_frame{};
+private:
 
-    const SampleFrame& getInputFrame(ptrdiff_t index)  const
+   const FrameSpan& m_in_span;
+   std::shared_ptr<const std::vector<CoefficientFormat>> m_converted_coefficients;   //set only if the filter had another format
+   const CoefficientFormat * m_coefficients;   //halfWidth coefficients ordered by distance, see CHalfFilter
+   const FoldedKernel<SampleFormat, CoefficientFormat, numChannels> m_kernel = SelectFoldedKernel<SampleFormat, CoefficientFormat, numChannels>();
+
+   template<typename OtherFormat> const CoefficientFormat * adoptCoefficients(const OtherFormat * coefficients)
    {
-      if (index >= 0 && index < m_in_span.size())
+      if constexpr (std::is_same<OtherFormat, CoefficientFormat>::value)
       {
-         return m_in_span[index];
+         return coefficients;
       }
       else
       {
-         return m_null_frame;
+         auto converted = std::make_shared<std::vector<CoefficientFormat>>(table_width / 2);
+         std::transform(coefficients, coefficients + table_width / 2, converted->begin(), [](OtherFormat c) { return QuantizeCoefficient<CoefficientFormat>(CoefficientValue(c)); });
+         m_converted_coefficients = converted;
+         return m_converted_coefficients->data();
       }
    }
 
-    const SampleFrame getInterpolatedFrame(ptrdiff_t index) const
+   const int halfWidth = table_width / 2;
+
+   static const size_t CACHE_LINE = 64;               //bytes
+   static const index_type MIN_FRAMES_PER_THREAD = 4096; //smaller chunks aren't worth starting a thread for
+
+    //calculates the frame interpolated between in[0] and in[1]
+    SampleFrame getInterpolatedFrame(const SampleFrame * in) const
    {
       SampleFrame outFrame;
+      AccumulatorFormat<CoefficientFormat> sums[numChannels];
+
+      //the filter is symmetric, so the kernel adds the two input frames at the same
+      //distance from the interpolated point first and multiplies them once
+      m_kernel(in[0].data(), in[1].data(), m_coefficients, halfWidth, sums);
+
+      for (size_t c = 0; c < numChannels; c++)
+         outFrame[c] = ToSample<SampleFormat>(sums[c]);
+
+      return outFrame;
+   }
 
-      ptrdiff_t i = index + 1 - halfWidth;
+    //upsamples the frames from first to last-1 of the input span, zero padding those
+    //the filter needs beyond its edges
+    void RunRange(index_type first, index_type last, SampleFrame * out) const
+   {
+      //interior frames have all of in[1-halfWidth]...in[halfWidth] inside the span
+      index_type interior_first = std::min(std::max<index_type>(first, halfWidth - 1), last);
+      index_type interior_last = std::max(std::min<index_type>(last, m_in_span.size() - halfWidth), interior_first);
+
+      RunPadded(first, interior_first, out);
+      RunInterior(m_in_span.data() + interior_first, interior_last - interior_first, out + 2 * (interior_first - first));
+      RunPadded(interior_last, last, out + 2 * (interior_last - first));
+   }
 
-      for (size_t j = 0; j<m_filter.size(); j++)
+    //splits the input into one chunk per thread and upsamples the chunks concurrently
+    void RunParallel(SampleFrame * out, unsigned threads) const
+   {
+      const index_type frames = m_in_span.size();
+      index_type chunks = std::min<index_type>(threads, frames / MIN_FRAMES_PER_THREAD);
+      if (chunks <= 1)
       {
-         outFrame += getInputFrame(i++)*m_filter[j];
+         RunRange(0, frames, out);
+         return;
       }
 
-      return outFrame;
+      std::vector<index_type> bounds{ 0 };
+      for (index_type chunk = 1; chunk < chunks; chunk++)
+         bounds.push_back(alignChunkBoundary(frames * chunk / chunks, out));
+      bounds.push_back(frames);
+
+      //every chunk reads its halfWidth frame halo straight from the input span and writes a disjoint part of the output
+      std::vector<std::thread> workers;
+      for (index_type chunk = 1; chunk < chunks; chunk++)
+         workers.emplace_back([this, &bounds, chunk, out]() { RunRange(bounds[chunk], bounds[chunk + 1], out + 2 * bounds[chunk]); });
+
+      RunRange(bounds[0], bounds[1], out);
+
+      for (std::thread& worker : workers)
+         worker.join();
+   }
+
+    //moves a chunk boundary forward so that the output of the next chunk starts as close to a cache line start as possible
+    index_type alignChunkBoundary(index_type boundary, const SampleFrame * out) const
+   {
+      index_type best = boundary;
+      size_t best_offset = CACHE_LINE;
+      for (index_type candidate = boundary; candidate < boundary + static_cast<index_type>(CACHE_LINE) && candidate < m_in_span.size(); candidate++)
+      {
+         size_t offset = reinterpret_cast<uintptr_t>(out + 2 * candidate) % CACHE_LINE;
+         if (offset < best_offset)
+         {
+            best = candidate;
+            best_offset = offset;
+         }
+         if (offset == 0)
+            break;
+      }
+      return best;
+   }
+
+    //upsamples edge frames through a staging window which is zero outside of the input span
+    void RunPadded(index_type first, index_type last, SampleFrame * out) const
+   {
+      if (first >= last)
+         return;
+
+      index_type origin = first - (halfWidth - 1);
+      FrameVector window(static_cast<size_type>(last - first + 2 * halfWidth - 1));
+
+      index_type copy_first = std::max<index_type>(origin, 0);
+      index_type copy_last = std::min<index_type>(last + halfWidth, m_in_span.size());
+      if (copy_first < copy_last)
+         std::copy(m_in_span.data() + copy_first, m_in_span.data() + copy_last, window.begin() + (copy_first - origin));
+
+      RunInterior(window.data() + (halfWidth - 1), last - first, out);
    }
 
 public:
 
-   FrameVector Run() const
+   //halfWidth coefficients ordered by distance, see CHalfFilter
+   const CoefficientFormat * Coefficients() const
    {
-      FrameVector output(2 * m_in_span.size());
+      return m_coefficients;
+   }
 
-      size_type j = 0;
+   size_t Width() const
+   {
+      return 2 * static_cast<size_t>(halfWidth);
+   }
 
-      for (index_type i = 0; i < m_in_span.size(); i++)
+   /* Upsamples count frames starting from in, writing 2*count frames to out.
+   No bounds are checked: the halfWidth-1 frames before in and the halfWidth
+   frames after in[count-1] must be readable.
+   */
+   void RunInterior(const SampleFrame * in, index_type count, SampleFrame * out) const
+   {
+      for (const SampleFrame * end = in + count; in != end; in++)
       {
          //alternate input and interpolated samples
-         output[j++] = getInputFrame(i);
-         output[j++] = getInterpolatedFrame(i);
+         *out++ = *in;
+         *out++ = getInterpolatedFrame(in);
       }
+   }
+
+   FrameVector Run() const
+   {
+      FrameVector output(2 * m_in_span.size());
+
+      RunRange(0, m_in_span.size(), output.data());
 
       return output;
    }
 
     void Run(FrameSpan& out_span)
    {
-      size_type j = 0;
+      if (out_span.size() < 2 * m_in_span.size())
+         throw std::runtime_error("Output span is too short");
 
-      for (index_type i = 0; i < m_in_span.size(); i++)
-      {
-         //alternate input and interpolated samples
-         out_span[j++] = getInputFrame(i);
-         out_span[j++] = getInterpolatedFrame(i);
-      }
+      RunRange(0, m_in_span.size(), out_span.data());
+   }
+
+   //the multithreaded versions produce exactly the same output as the single threaded ones
+   FrameVector Run(unsigned threads) const
+   {
+      FrameVector output(2 * m_in_span.size());
+
+      RunParallel(output.data(), threads);
+
+      return output;
+   }
+
+    void Run(FrameSpan& out_span, unsigned threads)
+   {
+      if (out_span.size() < 2 * m_in_span.size())
+         throw std::runtime_error("Output span is too short");
 
+      RunParallel(out_span.data(), threads);
    }
 };
 
+/* Planar doubler
+Upsamples audio kept as one contiguous buffer per channel rather than as
+interleaved frames. Every channel is processed by its own mono SRDoubler,
+so the filter walks unit-stride streams of samples.
+*/
+
+template<typename SampleFormat, size_t table_width> class CPlanarDoubler
+{
+public:
+   using MonoDoubler = SRDoubler<SampleFormat, 1, table_width>;
+   using ChannelSpan = typename MonoDoubler::FrameSpan;
+   using ChannelVector = typename MonoDoubler::FrameVector;
+   using ChannelSpans = std::vector<ChannelSpan>;
+   using ChannelVectors = std::vector<ChannelVector>;
+
+   //filter is what a mono SRDoubler is constructed with after its input span
+   template<typename... FilterType> CPlanarDoubler(const ChannelSpans& in_spans, const FilterType&... filter)
+   {
+      for (const ChannelSpan& channel : in_spans)
+         m_doublers.emplace_back(channel, filter...);
+   }
+
+   ChannelVectors Run(unsigned threads = 1) const
+   {
+      ChannelVectors output;
+
+      for (const MonoDoubler& doubler : m_doublers)
+         output.push_back(doubler.Run(threads));
+
+      return output;
+   }
+
+   void Run(ChannelSpans& out_spans, unsigned threads = 1)
+   {
+      if (out_spans.size() != m_doublers.size())
+         throw std::runtime_error("Wrong number of output channels");
+
+      for (size_t c = 0; c < m_doublers.size(); c++)
+         m_doublers[c].Run(out_spans[c], threads);
+   }
+
+private:
+
+   std::vector<MonoDoubler> m_doublers;
+};
@@ -0,0 +1,324 @@
+/*
+Filter Cache
+
+Keeps the filter tables SRDoubler is built with in files, so that a process
+maps a table another one has calculated instead of calculating it again.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "MappedFile.h"
+#include "FastFilterDesign.h"
+#include "MinimumPhaseDoubler.h"
+#include "FilterTables.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+
+/* Filter table files
+A table file starts with SFilterTableHeader, which holds everything the
+coefficients depend on, and continues with the coefficients at the offset the
+header gives: the halfWidth ones of a CHalfFilter for the Keiser design, the
+2*table_width ones of MinimumPhaseKeiserTables() for the minimum phase one.
+The coefficients are stored as they are in memory, so a file is only
+accepted by a process with the same byte order and coefficient format; any
+change of the layout or of the way the tables are calculated should increase
+FILTER_TABLE_VERSION.
+*/
+
+enum class FilterDesign : uint32_t
+{
+   Keiser = 1,         //linear phase Keiser window filter
+   MinimumPhase = 2,   //minimum phase filter with the magnitude response of the Keiser one
+};
+
+inline const char * FilterDesignName(FilterDesign design)
+{
+   switch (design)
+   {
+   case FilterDesign::Keiser: return "keiser";
+   case FilterDesign::MinimumPhase: return "minphase";
+   }
+   return "unknown";
+}
+
+const uint32_t FILTER_TABLE_VERSION = 2;
+
+struct SFilterTableHeader
+{
+   char magic[8];               //"SRDTABLE"
+   uint32_t version;
+   uint32_t byte_order;         //0x01020304 as written by the process that created the file
+   uint32_t coefficients_offset;
+   uint32_t design;
+   uint64_t table_width;
+   double alpha;
+   uint32_t coefficient_bits;   //width of a coefficient
+   uint32_t fixed_point_bits;   //fractional bits of integer coefficients, 0 for floating point ones
+   uint64_t count;              //coefficients stored
+   uint64_t checksum;           //FNV-1a hash of the coefficient bytes; it detects a damaged file, not a forged one
+};
+
+/* Cached half filter
+Provides the coefficients of CHalfFilter<table_width, CoefficientFormat>, or
+those of MinimumPhaseKeiserTables() for FilterDesign::MinimumPhase.
+The Keiser tables of the presets in FilterTables.h, which FilterTableGenerator
+writes at build time, are used directly: they are constant arrays in the
+read-only pages of the program, so nothing is calculated or read for them.
+Any other table is looked for in the cache directory, which is SRDOUBLER_CACHE if
+that is set or an SRDoubler directory in the cache directory of the user
+otherwise, and is mapped read-only if a valid file is there, so that all the
+processes using it share one physical copy. Otherwise the table is calculated with
+FastKeiserHalfTable(), split between all the cores when the table is wide
+enough, or MinimumPhaseKeiserTables() and written to a temporary file which
+is renamed to its final name, so that other processes never see a partial
+file, and the new file is mapped. If the file can't be written or mapped the calculated table is used; an empty SRDOUBLER_CACHE
+disables the cache altogether.
+
+The header and the checksum only reject files that are stale or damaged: a
+table file is trusted as much as the directory it is in. That is why the
+default directory belongs to the user rather than being a shared one like
+the temporary directory, where anybody could plant a table, why a cache
+directory this class creates is accessible to its owner only, and why there
+is no cache when the user has no such directory.
+
+data() points to the coefficients in the order CHalfFilter keeps them, which
+is what the SRDoubler constructor taking a coefficient pointer expects, or in
+the order CMinimumPhaseDoubler expects them. With DYNAMIC_TABLE_WIDTH the
+width is given to the constructor.
+*/
+
+template<size_t table_width, typename CoefficientFormat = double> class CCachedHalfFilter
+{
+public:
+   using HalfFilterType = CHalfFilter<table_width, CoefficientFormat>;
+
+   CCachedHalfFilter(double alpha, FilterDesign design = FilterDesign::Keiser, size_t width = table_width) : m_table_width{ width }, m_count{ Count(design, width) }
+   {
+      if (width < 2 || width % 2 != 0 || (table_width != DYNAMIC_TABLE_WIDTH && width != table_width))
+         throw std::runtime_error("Wrong table width");
+
+      if (design == FilterDesign::Keiser && (m_coefficients = preset(alpha)) != nullptr)
+         return;
+
+      SFilterTableHeader header = makeHeader(alpha, design);
+      std::filesystem::path directory = CacheDirectory();
+      if (directory.empty())
+      {
+         calculate(alpha, design);
+         return;
+      }
+
+      std::filesystem::path path = directory / fileName(header);
+      if (map(path, header))
+         return;
+
+      calculate(alpha, design);
+      if (store(directory, path, header))
+         map(path, header);
+   }
+
+   CCachedHalfFilter(const CCachedHalfFilter&) = delete;
+   CCachedHalfFilter& operator=(const CCachedHalfFilter&) = delete;
+
+   const CoefficientFormat * data() const
+   {
+      return m_coefficients;
+   }
+
+   //coefficients a table of the design and width holds
+   static size_t Count(FilterDesign design, size_t width = table_width)
+   {
+      return (design == FilterDesign::MinimumPhase) ? 2 * width : width / 2;
+   }
+
+   size_t Width() const
+   {
+      return m_table_width;
+   }
+
+   //true if the coefficients come from a mapped table file
+   bool IsMapped() const
+   {
+      return m_file != nullptr;
+   }
+
+   //true if the coefficients come from a table compiled into the program
+   bool IsPreset() const
+   {
+      return !m_file && m_calculated.empty();
+   }
+
+   //the directory table files are kept in, or an empty path if caching is disabled
+   static std::filesystem::path CacheDirectory()
+   {
+      if (const char * directory = std::getenv("SRDOUBLER_CACHE"))
+         return std::filesystem::path{ directory };
+
+#ifdef _WIN32
+      const char * local = std::getenv("LOCALAPPDATA");
+      if (local && *local)
+         return std::filesystem::path{ local } / "SRDoubler";
+#else
+      //the XDG base directory specification ignores relative paths
+      const char * xdg = std::getenv("XDG_CACHE_HOME");
+      if (xdg && *xdg == '/')
+         return std::filesystem::path{ xdg } / "SRDoubler";
+      const char * home = std::getenv("HOME");
+      if (home && *home)
+         return std::filesystem::path{ home } / ".cache" / "SRDoubler";
+#endif
+      return std::filesystem::path{};
+   }
+
+private:
+
+   static const uint32_t COEFFICIENTS_OFFSET = 64;   //keeps the coefficients cache line aligned
+   const size_t m_table_width;
+   const size_t m_count;   //coefficients in the table
+   std::unique_ptr<CMappedFile> m_file;
+   std::vector<CoefficientFormat> m_calculated;
+   const CoefficientFormat * m_coefficients = nullptr;
+
+   static_assert(sizeof(SFilterTableHeader) <= COEFFICIENTS_OFFSET, "The header should fit before the coefficients");
+
+   SFilterTableHeader makeHeader(double alpha, FilterDesign design) const
+   {
+      SFilterTableHeader header;
+      memset(&header, 0, sizeof(header));
+      memcpy(header.magic, "SRDTABLE", sizeof(header.magic));
+      header.version = FILTER_TABLE_VERSION;
+      header.byte_order = 0x01020304;
+      header.coefficients_offset = COEFFICIENTS_OFFSET;
+      header.design = static_cast<uint32_t>(design);
+      header.table_width = m_table_width;
+      header.alpha = alpha;
+      header.coefficient_bits = static_cast<uint32_t>(8 * sizeof(CoefficientFormat));
+      header.fixed_point_bits = std::is_integral<CoefficientFormat>::value ? FIXED_POINT_BITS : 0;
+      header.count = m_count;
+      return header;
+   }
+
+   //the name tells the tables apart; alpha is written as the bits of the double so that no digits are lost
+   static std::string fileName(const SFilterTableHeader& header)
+   {
+      uint64_t alpha_bits;
+      memcpy(&alpha_bits, &header.alpha, sizeof(alpha_bits));
+      char name[128];
+      snprintf(name, sizeof(name), "%s_w%llu_a%016llx_%c%u.%u.srdt", FilterDesignName(static_cast<FilterDesign>(header.design)),
+               static_cast<unsigned long long>(header.table_width), static_cast<unsigned long long>(alpha_bits),
+               header.fixed_point_bits ? 'q' : 'f', header.fixed_point_bits ? header.fixed_point_bits : header.coefficient_bits, header.version);
+      return name;
+   }
+
+   //the compiled table of a Keiser preset with these parameters, if there is one
+   const CoefficientFormat * preset(double alpha) const
+   {
+      for (const SPresetFilterTable& table : PRESET_FILTER_TABLES)
+      {
+         if (table.table_width != m_table_width || table.alpha != alpha)
+            continue;
+         if constexpr (std::is_same<CoefficientFormat, double>::value)
+            return table.f64;
+         else if constexpr (std::is_same<CoefficientFormat, float>::value)
+            return table.f32;
+         else if constexpr (std::is_same<CoefficientFormat, int32_t>::value)
+            return (PRESET_FIXED_POINT_BITS == FIXED_POINT_BITS) ? table.fixed : nullptr;
+      }
+      return nullptr;
+   }
+
+   static uint64_t checksum(const uint8_t * bytes, size_t size)
+   {
+      uint64_t hash = 14695981039346656037ull;
+      for (size_t i = 0; i < size; i++)
+         hash = (hash ^ bytes[i]) * 1099511628211ull;
+      return hash;
+   }
+
+   bool map(const std::filesystem::path& path, const SFilterTableHeader& expected)
+   {
+      auto file = std::make_unique<CMappedFile>(path.string().c_str(), CMappedFile::Access::ReadOnly);
+      const size_t table_bytes = m_count * sizeof(CoefficientFormat);
+      if (!file->IsMapped() || file->Size() < COEFFICIENTS_OFFSET + table_bytes)
+         return false;
+
+      SFilterTableHeader header;
+      memcpy(&header, file->Data(), sizeof(header));
+      const uint8_t * coefficients = file->Data() + COEFFICIENTS_OFFSET;
+      header.checksum = expected.checksum;   //compared separately below
+      if (memcmp(&header, &expected, sizeof(header)) != 0)
+         return false;
+      memcpy(&header, file->Data(), sizeof(header));
+      if (header.checksum != checksum(coefficients, table_bytes))
+         return false;
+
+      m_coefficients = reinterpret_cast<const CoefficientFormat *>(coefficients);
+      m_file = std::move(file);
+      m_calculated = std::vector<CoefficientFormat>{};
+      return true;
+   }
+
+   void calculate(double alpha, FilterDesign design)
+   {
+      m_calculated.resize(m_count);
+      if (design == FilterDesign::MinimumPhase)
+         MinimumPhaseKeiserTables(alpha, m_table_width, m_calculated.data());
+      else
+         FastKeiserHalfTable(alpha, m_table_width / 2, m_calculated.data(), std::thread::hardware_concurrency());   //only wide tables are split
+      m_coefficients = m_calculated.data();
+   }
+
+   bool store(const std::filesystem::path& directory, const std::filesystem::path& path, SFilterTableHeader header) const
+   {
+      std::error_code error;
+      if (std::filesystem::create_directories(directory, error))
+         std::filesystem::permissions(directory, std::filesystem::perms::owner_all, error);
+
+      const size_t table_bytes = m_count * sizeof(CoefficientFormat);
+      header.checksum = checksum(reinterpret_cast<const uint8_t *>(m_coefficients), table_bytes);
+
+      //a name no other thread or process writes to
+      size_t unique = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^ static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+      std::filesystem::path temporary = path;
+      temporary += "." + std::to_string(unique) + ".tmp";
+      {
+         std::ofstream file{ temporary, std::ios::binary };
+         char padding[COEFFICIENTS_OFFSET] = {};
+         file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+         file.write(padding, COEFFICIENTS_OFFSET - sizeof(header));
+         file.write(reinterpret_cast<const char *>(m_coefficients), table_bytes);
+         if (!file.flush())
+         {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return false;
+         }
+      }
+
+      //if another process has just stored the same table, either file will do
+      std::filesystem::rename(temporary, path, error);
+      if (error)
+         std::filesystem::remove(temporary, error);
+      return std::filesystem::exists(path, error);
+   }
+};
@@ -0,0 +1,281 @@
+/*
+Filter Quality
+
+Measures how closely SRDoubler with a given filter table width and alpha
+approaches ideal bandlimited interpolation.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "FastFilterDesign.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+/* Quality measurements
+Every measurement doubles a QUALITY_SAMPLE_RATE signal whose content lies
+below PASSBAND_EDGE and is given in dB, where lower is better:
+
+stopband        the largest gain of the filter over the images of the
+                passband, from QUALITY_SAMPLE_RATE - PASSBAND_EDGE up to
+                the input sampling rate
+passband ripple the largest deviation of the filter gain from unity over the
+                passband
+imaging         the worst, over a set of single tones, of the energy left
+                after the tone itself is fitted out of the output; since the
+                doubler passes the input samples through, whatever it images
+                into the new upper band is also the alias of the tone a
+                later downsampler would see
+THD+N           the energy of the difference between the output and the
+                test signal sampled at the doubled rate, relative to the
+                signal, for a multi-tone and for a faded logarithmic sweep
+
+The gains are calculated from the coefficients, the others from the output
+of SRDoubler. A QUALITY_FRAMES frame signal is used and the frames closer
+than the filter width to its edges, where the doubler zero pads, are left
+out, so that the interior measured stays at least half of the signal for
+widths up to MAX_QUALITY_WIDTH; wider tables are rejected. Throughput is measured separately, by doubling a mono double signal of
+the same length with Run(FrameSpan&); it depends on the table width but not
+on alpha.
+*/
+
+const double QUALITY_SAMPLE_RATE = 44100;
+const double PASSBAND_EDGE = 20000;
+const size_t QUALITY_FRAMES = 65536;
+const size_t MAX_QUALITY_WIDTH = QUALITY_FRAMES / 4;
+const size_t RESPONSE_POINTS = 4096;             //frequencies the gain is calculated at in either band
+const double SWEEP_START = 20;                  //Hz
+const size_t SWEEP_FADE = 2048;                 //frames faded in and out
+const double TEST_TONES[] = { 1000, 5000, 10000, 15000, 19000, 20000 };
+const double MULTI_TONES[] = { 100, 997, 3163, 7019, 12007, 16931, 19997 };
+
+struct SFilterQuality
+{
+   size_t table_width = 0;
+   double alpha = 0;
+   double stopband_db = 0;
+   double passband_ripple_db = 0;
+   double imaging_db = 0;
+   double thdn_multitone_db = 0;
+   double thdn_sweep_db = 0;
+   double frames_per_second = 0;   //output frames
+
+   //the level of the worst artifact, which is what a quality tier limits
+   double WorstDb() const
+   {
+      return std::max({ stopband_db, passband_ripple_db, imaging_db, thdn_multitone_db, thdn_sweep_db });
+   }
+};
+
+inline double ToDb(double energy_ratio)
+{
+   return 10 * std::log10(std::max(energy_ratio, 1E-300));
+}
+
+/* The doubler's output is the zero stuffed input convolved with a filter
+whose center tap is 1 and whose taps at odd distances 2*dist+1 are the
+coefficients, so that its gain is half of 1 + 2*sum(c[dist]*cos((2*dist+1)*w)).
+The cosines are generated with the Chebyshev recurrence.
+*/
+template<typename CoefficientFormat>
+inline double DoublerGain(const CoefficientFormat * coefficients, size_t halfWidth, double cycles_per_output_frame)
+{
+   const double w = 2 * PI * cycles_per_output_frame;
+   const double step = 2 * std::cos(2 * w);
+   double previous = std::cos(-w), current = std::cos(w), sum = 0;
+   for (size_t dist = 0; dist < halfWidth; dist++)
+   {
+      sum += CoefficientValue(coefficients[dist]) * current;
+      double next = step * current - previous;
+      previous = current;
+      current = next;
+   }
+   return (1 + 2 * sum) / 2;
+}
+
+//out[n] is the output frame n of an ideal doubler of signal, a function of the time in input frames
+inline std::vector<double> IdealDoubled(const std::function<double(double)>& signal, size_t frames)
+{
+   std::vector<double> out(2 * frames);
+   for (size_t n = 0; n < out.size(); n++)
+      out[n] = signal(n / 2.);
+   return out;
+}
+
+//the energy left in output[first...last-1] once the least squares fit of a sine of frequency cycles_per_output_frame is subtracted, relative to the fit
+inline double ResidualAfterToneFit(const std::vector<double>& output, size_t first, size_t last, double cycles_per_output_frame)
+{
+   const double w = 2 * PI * cycles_per_output_frame;
+   double cc = 0, ss = 0, cs = 0, yc = 0, ys = 0;
+   for (size_t n = first; n < last; n++)
+   {
+      double c = std::cos(w * n), s = std::sin(w * n);
+      cc += c * c;
+      ss += s * s;
+      cs += c * s;
+      yc += output[n] * c;
+      ys += output[n] * s;
+   }
+   double determinant = cc * ss - cs * cs;
+   double a = (yc * ss - ys * cs) / determinant, b = (ys * cc - yc * cs) / determinant;
+
+   double residual = 0, fitted = 0;
+   for (size_t n = first; n < last; n++)
+   {
+      double fit = a * std::cos(w * n) + b * std::sin(w * n);
+      residual += (output[n] - fit) * (output[n] - fit);
+      fitted += fit * fit;
+   }
+   return residual / fitted;
+}
+
+//the energy of the difference between output and ideal over first...last-1, relative to ideal
+inline double RelativeError(const std::vector<double>& output, const std::vector<double>& ideal, size_t first, size_t last)
+{
+   double error = 0, signal = 0;
+   for (size_t n = first; n < last; n++)
+   {
+      error += (output[n] - ideal[n]) * (output[n] - ideal[n]);
+      signal += ideal[n] * ideal[n];
+   }
+   return error / signal;
+}
+
+//a logarithmic sweep from SWEEP_START to PASSBAND_EDGE over frames frames with raised cosine fades, in input frames
+inline std::function<double(double)> FadedSweep(size_t frames)
+{
+   const double f1 = SWEEP_START / QUALITY_SAMPLE_RATE, f2 = PASSBAND_EDGE / QUALITY_SAMPLE_RATE;
+   const double duration = static_cast<double>(frames), rate = std::log(f2 / f1) / duration;
+   return [=](double t)
+   {
+      double phase = 2 * PI * f1 * (std::exp(rate * t) - 1) / rate;
+      double fade = 1;
+      if (t < SWEEP_FADE)
+         fade = 0.5 - 0.5 * std::cos(PI * std::max(t, 0.) / SWEEP_FADE);
+      else if (t > duration - SWEEP_FADE)
+         fade = 0.5 - 0.5 * std::cos(PI * std::max(duration - t, 0.) / SWEEP_FADE);
+      return 0.5 * fade * std::sin(phase);
+   };
+}
+
+template<size_t table_width> class CFilterQualityMeter
+{
+public:
+   using MonoDoubler = SRDoubler<double, 1, table_width>;
+   using FrameVector = typename MonoDoubler::FrameVector;
+   using FrameSpan = typename MonoDoubler::FrameSpan;
+
+   //with DYNAMIC_TABLE_WIDTH the width is given to the constructor
+   CFilterQualityMeter(double alpha, size_t width = table_width) : m_alpha{ alpha }, m_width{ width }, m_coefficients(width / 2)
+   {
+      if (width > MAX_QUALITY_WIDTH)
+         throw std::runtime_error("The table is too wide for the quality test signal");
+      FastKeiserHalfTable(alpha, width / 2, m_coefficients.data());
+   }
+
+   //measures everything but the throughput
+   SFilterQuality Measure() const
+   {
+      SFilterQuality quality{ m_width, m_alpha };
+      measureResponse(quality);
+
+      //the interior of the output, where the doubler had all the input frames it needed
+      const size_t first = 2 * m_width, last = 2 * (QUALITY_FRAMES - m_width);
+
+      double imaging = 0;
+      for (double tone : TEST_TONES)
+      {
+         const double f = tone / QUALITY_SAMPLE_RATE;
+         imaging = std::max(imaging, ResidualAfterToneFit(upsample(sampled([f](double t) { return 0.5 * std::sin(2 * PI * f * t); })), first, last, f / 2));
+      }
+      quality.imaging_db = ToDb(imaging);
+
+      auto multitone = [](double t)
+      {
+         double sum = 0;
+         for (size_t i = 0; i < sizeof(MULTI_TONES) / sizeof(MULTI_TONES[0]); i++)
+            sum += 0.1 * std::sin(2 * PI * MULTI_TONES[i] / QUALITY_SAMPLE_RATE * t + i);
+         return sum;
+      };
+      quality.thdn_multitone_db = ToDb(RelativeError(upsample(sampled(multitone)), IdealDoubled(multitone, QUALITY_FRAMES), first, last));
+
+      auto sweep = FadedSweep(QUALITY_FRAMES);
+      quality.thdn_sweep_db = ToDb(RelativeError(upsample(sampled(sweep)), IdealDoubled(sweep, QUALITY_FRAMES), first, last));
+      return quality;
+   }
+
+   //the median output frames per second of repetitions runs after a warm-up one
+   double MeasureThroughput(unsigned repetitions) const
+   {
+      FrameVector input = sampled([](double t) { return 0.5 * std::sin(2 * PI * t / 100); });
+      FrameSpan span{ input };
+      MonoDoubler doubler{ span, m_coefficients.data(), m_width };
+      FrameVector output(2 * input.size());
+      FrameSpan output_span{ output };
+
+      std::vector<double> seconds;
+      for (unsigned repetition = 0; repetition <= repetitions; repetition++)
+      {
+         auto start = std::chrono::steady_clock::now();
+         doubler.Run(output_span);
+         auto end = std::chrono::steady_clock::now();
+         if (repetition > 0)
+            seconds.push_back(std::chrono::duration<double>(end - start).count());
+      }
+      std::sort(seconds.begin(), seconds.end());
+      return output.size() / seconds[seconds.size() / 2];
+   }
+
+private:
+
+   const double m_alpha;
+   const size_t m_width;
+   std::vector<double> m_coefficients;
+
+   void measureResponse(SFilterQuality& quality) const
+   {
+      const double edge = PASSBAND_EDGE / (2 * QUALITY_SAMPLE_RATE);   //in cycles per output frame
+      double stopband = 0, ripple = 0;
+      for (size_t point = 0; point <= RESPONSE_POINTS; point++)
+      {
+         double f = edge * point / RESPONSE_POINTS;
+         ripple = std::max(ripple, std::abs(DoublerGain(m_coefficients.data(), m_width / 2, f) - 1));
+         stopband = std::max(stopband, std::abs(DoublerGain(m_coefficients.data(), m_width / 2, 0.5 - f)));
+      }
+      quality.stopband_db = 20 * std::log10(std::max(stopband, 1E-150));
+      quality.passband_ripple_db = 20 * std::log10(std::max(ripple, 1E-150));
+   }
+
+   static FrameVector sampled(const std::function<double(double)>& signal)
+   {
+      FrameVector frames(QUALITY_FRAMES);
+      for (size_t n = 0; n < QUALITY_FRAMES; n++)
+         frames[n][0] = signal(static_cast<double>(n));
+      return frames;
+   }
+
+   std::vector<double> upsample(const FrameVector& input) const
+   {
+      FrameSpan span{ const_cast<FrameVector&>(input) };
+      FrameVector doubled = MonoDoubler{ span, m_coefficients.data(), m_width }.Run();
+      std::vector<double> output(doubled.size());
+      for (size_t n = 0; n < doubled.size(); n++)
+         output[n] = doubled[n][0];
+      return output;
+   }
+
+};
@@ -0,0 +1,120 @@
+/*
+Filter Table Generator
+
+This program writes FilterTables.h, which holds the filter tables of the
+presets File_Upsampler uses as constant arrays, so that they are compiled
+into the program instead of being designed when it starts.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+#include "FileUpsampler.h"
+#include <cstdio>
+#include <string>
+
+const double ALPHA = 9;   //parameter of a Kaiser function
+
+/* The preset is the table File_Upsampler doubles with, which the stages of
+its cascades use as well. Every table is written in the three coefficient formats the doublers use, as
+CHalfFilter calculates it, and with the digits needed to read back the same
+value.
+*/
+
+static void writeValue(FILE * out, double value) { fprintf(out, "%.17g", value); }
+static void writeValue(FILE * out, float value) { fprintf(out, "%.9gf", value); }
+static void writeValue(FILE * out, int32_t value) { fprintf(out, "%d", value); }
+
+template<typename CoefficientFormat, size_t table_width> static void writeTable(FILE * out, const char * type, const std::string& name, double alpha)
+{
+   const size_t VALUES_PER_LINE = 4;
+   const CHalfFilter<table_width, CoefficientFormat> filter{ alpha };
+
+   fprintf(out, "alignas(64) constexpr %s %s[%zu] =\n{\n", type, name.c_str(), filter.size());
+   for (size_t dist = 0; dist < filter.size(); dist++)
+   {
+      fputs((dist % VALUES_PER_LINE == 0) ? "   " : " ", out);
+      writeValue(out, filter[dist]);
+      fputs((dist + 1 == filter.size()) ? "\n" : (dist % VALUES_PER_LINE == VALUES_PER_LINE - 1) ? ",\n" : ",", out);
+   }
+   fputs("};\n\n", out);
+}
+
+template<size_t table_width> static std::string writePreset(FILE * out, double alpha)
+{
+   std::string name = "KEISER_W" + std::to_string(table_width) + "_A" + std::to_string(static_cast<int>(alpha));
+   writeTable<double, table_width>(out, "double", name + "_F64", alpha);
+   writeTable<float, table_width>(out, "float", name + "_F32", alpha);
+   writeTable<int32_t, table_width>(out, "int32_t", name + "_Q" + std::to_string(FIXED_POINT_BITS), alpha);
+
+   char entry[256];
+   snprintf(entry, sizeof(entry), "   { %zu, %.17g, %s_F64, %s_F32, %s_Q%d },\n", table_width, alpha, name.c_str(), name.c_str(), name.c_str(), FIXED_POINT_BITS);
+   return entry;
+}
+
+int main(int argc, char ** argv)
+{
+   if (argc != 2)
+   {
+      printf("Usage: FilterTableGenerator <output header>\n");
+      return 0;
+   }
+
+   FILE * out = fopen(argv[1], "w");
+   if (!out)
+   {
+      printf("Failure to open the output file\n");
+      return -1;
+   }
+
+   fputs("/*\n"
+         "Filter Tables\n"
+         "\n"
+         "Generated by FilterTableGenerator from CHalfFilter, don't edit. Every table\n"
+         "holds the coefficients of a preset ordered by distance, like CHalfFilter.\n"
+         "*/\n"
+         "\n"
+         "#pragma once\n"
+         "\n"
+         "#include <cstddef>\n"
+         "#include <cstdint>\n"
+         "\n", out);
+   fprintf(out, "constexpr int PRESET_FIXED_POINT_BITS = %d;\n\n", FIXED_POINT_BITS);
+
+   std::string entries;
+   entries += writePreset<3200>(out, ALPHA);
+
+   fputs("struct SPresetFilterTable\n"
+         "{\n"
+         "   size_t table_width;\n"
+         "   double alpha;\n"
+         "   const double * f64;\n"
+         "   const float * f32;\n"
+         "   const int32_t * fixed;\n"
+         "};\n"
+         "\n"
+         "constexpr SPresetFilterTable PRESET_FILTER_TABLES[] =\n"
+         "{\n", out);
+   fputs(entries.c_str(), out);
+   fputs("};\n", out);
+
+   bool written = !ferror(out);
+   fclose(out);
+   if (!written)
+   {
+      printf("Failure to write the output file\n");
+      return -1;
+   }
+
+   printf("%s written\n", argv[1]);
+   return 0;
+}
@@ -0,0 +1,1239 @@
+/*
+Filter Tables
+
+Generated by FilterTableGenerator from CHalfFilter, don't edit. Every table
+holds the coefficients of a preset ordered by distance, like CHalfFilter.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr int PRESET_FIXED_POINT_BITS = 28;
+
+alignas(64) constexpr double KEISER_W3200_A9_F64[1600] =
+{
+   0.6366195089657648, -0.21220580058490615, 0.12732263747024758, -0.090943837970364386,
+   0.070733159681610938, -0.057871627404684475, 0.048967327602823643, -0.042437367293447208,
+   0.037443744310400436, -0.03350129950583669, 0.030309696265307946, -0.027673062884548374,
+   0.025458206605401188, -0.023571399191333733, 0.021944768471704883, -0.020527957675348429,
+   0.01928281773376227, -0.018179919366061524, 0.017196196379622337, -0.016313314108989292,
+   0.015516515384858482, -0.014793788558228341, 0.014135257384776743, -0.013532726683439692,
+   0.012979339262277002, -0.012469313567663469, 0.011997740733663401, -0.011560425911541487,
+   0.011153763003587105, -0.010774634874805015, 0.010420333195093031, -0.010088493549576373,
+   0.0097770425285724615, -0.0094841542939801942, 0.009208214699340361, -0.008947791474111377,
+   0.008701609309159853, -0.0084685289285728049, 0.0082475294230054813, -0.0080376932665713399,
+   0.0078381935534520691, -0.0076482830798169331, 0.0074672849671182607, -0.0072945845787254302,
+   0.0071296225264509709, -0.0069718885992928938, 0.0068209164755652692, -0.0066762791029700112,
+   0.0065375846502062941, -0.0064044729492939764, 0.0062766123605912019, -0.0061536970030527001,
+   0.0060354443010300386, -0.005921592806196997, 0.00581190025926302, -0.0057061418612311546,
+   0.0056041087282391929, -0.0055056065076348297, 0.005410454135991772, -0.005318482722367914,
+   0.0052295345423148537, -0.0051434621300327074, 0.0050601274576781256, -0.0049794011922180172,
+   0.0049011620214131097, -0.004825296041543495, 0.0047516962003769968, -0.0046802617896514317,
+   0.0046108979820109978, -0.0045435154079193482, 0.0044780297685801263, -0.0044143614813395909,
+   0.004352435354435337, -0.0042921802882960377, 0.0042335290008976732, -0.0041764177749457013,
+   0.0041207862248860642, -0.004066577081954092, 0.0040137359956527842, -0.0039622113502138043,
+   0.0039119540947384866, -0.0038629175858437169, 0.0038150574417517955, -0.0037683314068648597,
+   0.0037226992259552665, -0.0036781225271848373, 0.0036345647132382101, -0.0035919908599215014,
+   0.0035503676216354684, -0.0035096631431858366, 0.0034698469774403031, -0.0034308900083851643,
+   0.0033927643791728415, -0.0033554434247866863, 0.0033189016089810127, -0.0032831144651830342,
+   0.0032480585410692765, -0.0032137113465526908, 0.0031800513049380099, -0.0031470577070226023,
+   0.0031147106679374685, -0.0030829910865395951, 0.0030518806071812665, -0.0030213615836957282,
+   0.0029914170454505783, -0.0029620306653318005, 0.0029331867295315523, -0.0029048701090221519,
+   0.0028770662326075853, -0.0028497610614516052, 0.0028229410649889563, -0.0027965931981328278,
+   0.0027707048796979331, -0.0027452639719641771, 0.0027202587613112724, -0.0026956779398593219,
+   0.00267151058805493, -0.0026477461581465929, 0.0026243744584967012, -0.002601385638681297,
+   0.0025787701753316873, -0.0025565188586752848, 0.0025346227797356353, -0.0025130733181543282,
+   0.002491862130599804, -0.0024709811397303043, 0.0024504225236803246, -0.0024301787060418251,
+   0.0024102423463132528, -0.0023906063307910443, 0.0023712637638799469, -0.002352207959799831,
+   0.0023334324346679855, -0.0023149308989373297, 0.0022966972501719234, -0.0022787255661423666,
+   0.0022610100982247265, -0.0022435452650875157, 0.0022263256466520847, -0.0022093459783128966,
+   0.0021926011454045341, -0.0021760861779033303, 0.0021597962453521456, -0.0021437266519972868,
+   0.0021278728321273768, -0.0021122303456044245, 0.0020967948735779469, -0.0020815622143734035,
+   0.0020665282795467744, -0.0020516890900974583, 0.0020370407728321866, -0.0020225795568728847,
+   0.002008301770302015, -0.0019942038369389413, 0.0019802822732415599, -0.0019665336853274614,
+   0.0019529547661092741, -0.0019395422925391661, 0.0019262931229576375, -0.0019132041945420502,
+   0.0019002725208505434, -0.0018874951894571792, 0.0018748693596744336, -0.0018623922603592392,
+   0.0018500611877990667, -0.0018378735036746214, 0.001825826633095991, -0.0018139180627091067,
+   0.0018021453388696455, -0.0017905060658815735, 0.0017789979042976609, -0.0017676185692794722,
+   0.0017563658290143936, -0.0017452375031873932, 0.0017342314615053363, -0.0017233456222717494,
+   0.0017125779510100434, -0.0017019264591332456, 0.0016913892026584846, -0.0016809642809644128,
+   0.0016706498355899496, -0.0016604440490727401, 0.0016503451438257823, -0.0016403513810507903,
+   0.0016304610596869133, -0.0016206725153934366, 0.0016109841195652212, -0.0016013942783796348,
+   0.0015919014318738509, -0.0015825040530513144, 0.0015732006470164006, -0.0015639897501361418,
+   0.001554869929228113, -0.0015458397807734839, 0.001536897930154348, -0.0015280430309144606,
+   0.0015192737640425565, -0.0015105888372774164, 0.0015019869844339593, -0.0014934669647496135,
+   0.0014850275622502007, -0.0014766675851347578, 0.0014683858651785432, -0.001460181257153671,
+   0.0014520526382667241, -0.0014439989076128021, 0.0014360189856454269, -0.0014281118136617605,
+   0.0014202763533026715, -0.0014125115860670809, 0.0014048165128401769, -0.0013971901534350019,
+   0.00138963154614698, -0.0013821397473209695, 0.0013747138309304322, -0.0013673528881682935,
+   0.0013600560270491792, -0.0013528223720225825, 0.0013456510635966904, -0.0013385412579724669,
+   0.0013314921266877023, -0.0013245028562707162, 0.0013175726479033633, -0.0013107007170931285,
+   0.0013038862933539594, -0.00129712861989559, 0.001290426953321109, -0.0012837805633324941,
+   0.0012771887324438754, -0.001270650755702296, 0.0012641659404157579, -0.0012577336058882907,
+   0.0012513530831618652, -0.0012450237147649552, 0.001238744854467508, -0.0012325158670421679,
+   0.0012263361280315601, -0.0012202050235214606, 0.0012141219499196396, -0.0012080863137402867,
+   0.0012020975313937947, -0.0011961550289817482, 0.0011902582420970295, -0.0011844066156287969,
+   0.0011785996035722905, -0.0011728366688432638, 0.0011671172830969405, -0.0011614409265513553,
+   0.0011558070878149574, -0.0011502152637183798, 0.0011446649591502006, -0.0011391556868966615,
+   0.0011336869674851678, -0.001128258329031502, 0.0011228693070906442, -0.00111751944451108,
+   0.0011122082912925371, -0.00110693540444702, 0.0011017003478630727, -0.0010965026921731904,
+   0.0010913420146242633, -0.0010862178989510278, 0.0010811299352523603, -0.0010760777198704425,
+   0.0010710608552726222, -0.0010660789499359739, 0.0010611316182344366, -0.0010562184803285027,
+   0.0010513391620573563, -0.0010464932948334152, 0.0010416805155392212, -0.0010369004664266032,
+   0.0010321527950180496, -0.0010274371540102618, 0.0010227532011798178, -0.0010181005992908562,
+   0.0010134790160048065, -0.0010088881237920492, 0.0010043275998454771, -0.00099979712599591419,
+   0.00099529638862935472, -0.00099082507860595104, 0.00098638289118072714, -0.00098196952592597428,
+   0.00097758468665528047, -0.00097322808134915183, 0.00096889942208219456, -0.00096459842495182492,
+   0.00096032481000844164, -0.00095607830118706982, 0.00095185862624039589, -0.00094766551667319217,
+   0.00094349870767808299, -0.00093935793807262342, 0.0009352429502376611, -0.0009311534900569502,
+   0.0009270893068579829, -0.00092305015335401603, 0.00091903578558726886, -0.00091504596287325212,
+   0.00091108044774620013, -0.00090713900590561872, 0.00090322140616385055, -0.00089932742039471416,
+   0.00089545682348313399, -0.00089160939327576918, 0.00088778491053259775, -0.00088398315887946598,
+   0.00088020392476152861, -0.00087644699739763141, 0.00087271216873553291, -0.00086899923340802963,
+   0.00086530798868988208, -0.00086163823445560821, 0.00085798977313804206, -0.00085436240968770759,
+   0.00085075595153295347, -0.00084717020854083657, 0.00084360499297875095, -0.00084006011947676833,
+   0.00083653540499069529, -0.00083303066876580674, 0.00082954573230125674, -0.00082608041931516547,
+   0.00082263455571032426, -0.00081920796954055534, 0.00081580049097768092, -0.00081241195227909398,
+   0.00080904218775593075, -0.00080569103374180848, 0.00080235832856215088, -0.00079904391250404426,
+   0.00079574762778666268, -0.00079246931853220058, 0.00078920883073734936, -0.00078596601224526592,
+   0.00078274071271805491, -0.00077953278360972484, 0.0007763420781396437, -0.00077316845126644031,
+   0.00077001175966238456, -0.00076687186168821137, 0.00076374861736838013, -0.00076064188836677126,
+   0.00075755153796281283, -0.0007544774310280013, 0.00075141943400285408, -0.00074837741487424297,
+   0.00074535124315311949, -0.00074234078985263325, 0.00073934592746660718, -0.00073636652994839931,
+   0.00073340247269011022, -0.00073045363250214825, 0.00072751988759314236, -0.00072460111755019382,
+   0.00072169720331945002, -0.00071880802718702437, 0.00071593347276021626, -0.00071307342494905169,
+   0.0007102277699481364, -0.00070739639521880094, 0.00070457918947154673, -0.00070177604264878022,
+   0.00069898684590783344, -0.00069621149160425824, 0.00069344987327539737, -0.00069070188562422592,
+   0.00068796742450345186, -0.00068524638689987643, 0.00068253867091900644, -0.00067984417576991856,
+   0.0006771628017503596, -0.00067449445023209974, 0.00067183902364650536, -0.00066919642547035225,
+   0.00066656656021185905, -0.00066394933339694953, 0.00066134465155572595, -0.00065875242220915574,
+   0.00065617255385597823, -0.00065360495595980536, 0.00065104953893642761, -0.00064850621414132737,
+   0.00064597489385737267, -0.00064345549128271571, 0.00064094792051886708, -0.00063845209655896868,
+   0.00063596793527623599, -0.00063349535341258119, 0.00063103426856741585, -0.00062858459918661803,
+   0.00062614626455167457, -0.00062371918476898495, 0.00062130328075932987, -0.00061889847424749641,
+   0.00061650468775206345, -0.00061412184457534285, 0.0006117498687934665, -0.00060938868524662603,
+   0.00060703821952945566, -0.00060469839798156868, 0.00060236914767821759, -0.00060005039642111119,
+   0.00059774207272935136, -0.00059544410583052152, 0.00059315642565189184, -0.00059087896281175695,
+   0.00058861164861091016, -0.00058635441502423132, 0.00058410719469240537, -0.00058186992091375437,
+   0.00057964252763619277, -0.00057742494944930465, 0.000575217121576527, -0.00057301897986744197,
+   0.00057083046079020117, -0.00056865150142403412, 0.00056648203945187849, -0.00056432201315311078,
+   0.00056217136139638502, -0.00056003002363256768, 0.00055789793988777895, -0.0005557750507565268,
+   0.00055366129739494081, -0.00055155662151410367, 0.00054946096537347288, -0.00054737427177439422,
+   0.00054529648405371466, -0.00054322754607747043, 0.00054116740223467466, -0.00053911599743118816,
+   0.00053707327708367133, -0.00053503918711362436, 0.00053301367394151147, -0.00053099668448095688,
+   0.0005289881661330344, -0.00052698806678062068, 0.00052499633478283862, -0.00052301291896956559,
+   0.00052103776863602692, -0.00051907083353745483, 0.00051711206388382251, -0.00051516141033465176,
+   0.0005132188239938899, -0.00051128425640484948, 0.0005093576595452255, -0.00050743898582217533,
+   0.00050552818806746187, -0.00050362521953266489, 0.00050173003388445723, -0.00049984258519994006,
+   0.00049796282796204269, -0.00049609071705498215, 0.00049422620775978264, -0.00049236925574985824,
+   0.00049051981708664446, -0.00048867784821529734, 0.00048684330596044279, -0.00048501614752197988,
+   0.00048319633047095038, -0.0004813838127454438, 0.0004795785526465734, -0.00047778050883449155,
+   0.00047598964032446295, -0.00047420590648298818, 0.00047242926702397667, -0.00047065968200496493,
+   0.00046889711182339025, -0.00046714151721290664, 0.00046539285923975017, -0.00046365109929914994,
+   0.00046191619911178602, -0.00046018812072028695, 0.00045846682648578474, -0.00045675227908449433,
+   0.00045504444150435412, -0.00045334327704169437, 0.00045164874929796219, -0.00044996082217647231,
+   0.00044827945987920947, -0.00044660462690366599, 0.0004449362880397213, -0.00044327440836655445,
+   0.00044161895324960475, -0.00043996988833756124, 0.00043832717955939239, -0.00043669079312141343,
+   0.00043506069550439152, -0.00043343685346067891, 0.00043181923401139046, -0.0004302078044436097,
+   0.00042860253230763155, -0.00042700338541423825, 0.00042541033183200792, -0.00042382333988465421,
+   0.00042224237814840454, -0.0004206674154494002, 0.00041909842086113665, -0.00041753536370192938,
+   0.00041597821353241458, -0.00041442694015307303, 0.0004128815136017934, -0.00041134190415145262,
+   0.00040980808230753709, -0.00040828001880578458, 0.00040675768460985627, -0.00040524105090903575,
+   0.00040373008911595798, -0.00040222477086436108, 0.00040072506800686988, -0.00039923095261279636,
+   0.00039774239696597873, -0.00039625937356263345, 0.0003947818551092431, -0.00039330981452045911,
+   0.00039184322491703569, -0.00039038205962378789, 0.00038892629216756585, -0.00038747589627526405,
+   0.00038603084587184272, -0.00038459111507838063, 0.000383156678210145, -0.00038172750977468389,
+   0.00038030358446994387, -0.00037888487718240594, 0.00037747136298524727, -0.00037606301713651605,
+   0.00037465981507733549, -0.00037326173243012269, 0.00037186874499683242, -0.00037048082875721462,
+   0.00036909795986709947, -0.00036772011465669352, 0.00036634726962890188, -0.00036497940145766532,
+   0.00036361648698631736, -0.00036225850322596238, 0.00036090542735386357, -0.00035955723671186185,
+   0.00035821390880480026, -0.00035687542129897199, 0.00035554175202058466, -0.00035421287895424426,
+   0.00035288878024144848, -0.00035156943417910546, 0.0003502548192180636, -0.00034894491396165908,
+   0.00034763969716427803, -0.00034633914772993888, 0.00034504324471088346, -0.00034375196730619071,
+   0.00034246529486039816, -0.00034118320686214824, 0.00033990568294283438, -0.00033863270287528261,
+   0.00033736424657242604, -0.0003361002940860077, 0.00033484082560529408, -0.00033358582145579961,
+   0.00033233526209802786, -0.0003310891281262266, 0.00032984740026715425, -0.00032861005937885899,
+   0.00032737708644947627, -0.00032614846259603169, 0.00032492416906326294, -0.00032370418722244964,
+   0.00032248849857026028, -0.00032127708472760755, 0.00032006992743851566, -0.00031886700856900517,
+   0.00031766831010598251, -0.0003164738141561449, 0.00031528350294489772, -0.00031409735881527984,
+   0.00031291536422690502, -0.00031173750175490968, 0.0003105637540889133, -0.00030939410403199444,
+   0.00030822853449966612, -0.00030706702851887601, 0.00030590956922700553, -0.0003047561398708863,
+   0.00030360672380582175, -0.00030246130449462582, 0.0003013198655066622, -0.00030018239051690253,
+   0.00029904886330498972, -0.00029791926775430837, 0.00029679358785107262, -0.00029567180768341609,
+   0.0002945539114404952, -0.00029343988341159945, 0.00029232970798527037, -0.00029122336964843514,
+   0.00029012085298553973, -0.00028902214267769865, 0.00028792722350185027, -0.00028683608032992051,
+   0.00028574869812799633, -0.00028466506195550548, 0.00028358515696440641, -0.00028250896839838589,
+   0.00028143648159206628, -0.0002803676819702162, 0.00027930255504697295, -0.00027824108642507481,
+   0.00027718326179509262, -0.00027612906693468009, 0.00027507848770782291, -0.0002740315100640987,
+   0.00027298812003794432, -0.0002719483037479324, 0.00027091204739605003, -0.00026987933726698913,
+   0.00026885015972744129, -0.00026782450122540233, 0.00026680234828948017, -0.00026578368752821287,
+   0.00026476850562939032, -0.0002637567893593855, 0.00026274852556248978, -0.00026174370116025902,
+   0.00026074230315085864, -0.00025974431860842156, 0.00025874973468241225, -0.00025775853859699168,
+   0.00025677071765039492, -0.00025578625921430912, 0.00025480515073326201, -0.00025382737972401583,
+   0.00025285293377496146, -0.00025188180054552724, 0.00025091396776558698, -0.00024994942323487533,
+   0.00024898815482241249, -0.00024803015046592628, 0.00024707539817128953, -0.00024612388601195548,
+   0.00024517560212840105, -0.00024423053472757701, 0.00024328867208236213, -0.00024235000253102081,
+   0.00024141451447666878, -0.000240482196386743, 0.00023955303679247552, -0.00023862702428837339,
+   0.00023770414753170328, -0.0002367843952419817, 0.00023586775620046673, -0.00023495421924966237,
+   0.00023404377329281579, -0.00023313640729343132, 0.00023223211027478081, -0.00023133087131942321,
+   0.00023043267956872476, -0.00022953752422238846, 0.00022864539453798237, -0.00022775627983047844,
+   0.00022687016947178985, -0.00022598705289031773, 0.00022510691957049767, -0.00022422975905235406,
+   0.00022335556093105684, -0.00022248431485648177, 0.00022161601053277669, -0.00022075063771793152,
+   0.00021988818622334781, -0.00021902864591342172, 0.00021817200670511957, -0.00021731825856756776,
+   0.00021646739152163765, -0.00021561939563954067, 0.00021477426104442429, -0.00021393197790997191,
+   0.00021309253646000631, -0.00021225592696809785, 0.00021142213975717646, -0.00021059116519914363,
+   0.00020976299371449342, -0.00020893761577193271, 0.00020811502188800701, -0.00020729520262672749,
+   0.00020647814859920581, -0.00020566385046328733, 0.0002048522989231908, -0.00020404348472914869,
+   0.00020323739867705561, -0.000202434031608113, 0.00020163337440848401, -0.00020083541800894642,
+   0.00020004015338455044, -0.00019924757155428185, 0.00019845766358072336, -0.0001976704205697236,
+   0.00019688583367006633, -0.00019610389407314485, 0.0001953245930126365, -0.00019454792176418193,
+   0.00019377387164506792, -0.00019300243401391132, 0.00019223360027034725, -0.00019146736185471778,
+   0.00019070371024776747, -0.00018994263697033758, 0.00018918413358306525, -0.00018842819168608419,
+   0.00018767480291873015, -0.00018692395895924494, 0.00018617565152448867, -0.00018542987236964929,
+   0.000184686613287958, -0.00018394586611040535, 0.00018320762270546172, -0.00018247187497879818,
+   0.00018173861487301139, -0.00018100783436735105, 0.00018027952547744738, -0.00017955368025504424,
+   0.00017883029078773262, -0.00017810934919868686, 0.00017739084764640379, -0.00017667477832444229,
+   0.00017596113346116907, -0.00017524990531950194, 0.0001745410861966574, -0.00017383466842390308,
+   0.00017313064436630672, -0.00017242900642249363, 0.00017172974702439945, -0.00017103285863703341,
+   0.00017033833375823385, -0.00016964616491843578, 0.00016895634468043271, -0.00016826886563914398,
+   0.00016758372042138513, -0.0001669009016856375, 0.00016622040212182192, -0.00016554221445107335,
+   0.00016486633142551732, -0.00016419274582804997, 0.00016352145047211769, -0.00016285243820150032,
+   0.00016218570189009527, -0.00016152123444170477, 0.00016085902878982283, -0.00016019907789742668,
+   0.00015954137475676774, -0.00015888591238916595, 0.00015823268384480407, -0.00015758168220252698,
+   0.00015693290056963832, -0.00015628633208170331, 0.0001556419699023499, -0.00015499980722307274,
+   0.0001543598372630399, -0.00015372205326890046, 0.00015308644851459214, -0.00015245301630115412,
+   0.00015182174995653739, -0.00015119264283542091, 0.00015056568831902498, -0.00014994087981493035,
+   0.00014931821075689567, -0.00014869767460467861, 0.00014807926484385704, -0.00014746297498565274,
+   0.00014684879856675641, -0.0001462367291491536, 0.00014562676031995271, -0.0001450188856912145,
+   0.00014441309889978246, -0.00014380939360711563, 0.00014320776349912104, -0.00014260820228599071,
+   0.00014201070370203518, -0.00014141526150552474, 0.00014082186947852616, -0.00014023052142674356,
+   0.00013964121117936146, -0.00013905393258888701, 0.00013846867953099529, -0.0001378854459043743,
+   0.00013730422563057299, -0.00013672501265384965, 0.0001361478009410209, -0.00013557258448131367,
+   0.00013499935728621723, -0.00013442811338933646, 0.00013385884684624685, -0.00013329155173435038,
+   0.00013272622215273287, -0.00013216285222202238, 0.00013160143608424886, -0.00013104196790270491,
+   0.00013048444186180736, -0.00012992885216696088, 0.0001293751930444225, -0.00012882345874116601,
+   0.00012827364352474958, -0.00012772574168318286, 0.00012717974752479594, -0.00012663565537810866,
+   0.00012609345959170278, -0.00012555315453409305, 0.00012501473459360007, -0.00012447819417822596,
+   0.00012394352771552775, -0.00012341072965249509, 0.00012287979445542658, -0.00012235071660980897,
+   0.00012182349062019577, -0.00012129811101008787, 0.00012077457232181516, -0.00012025286911641824,
+   0.00011973299597353295, -0.00011921494749127317, 0.00011869871828611722, -0.00011818430299279354,
+   0.00011767169626416788, -0.0001171608927711318, 0.00011665188720249155, -0.00011614467426485734,
+   0.00011563924868253554, -0.00011513560519741961, 0.00011463373856888242, -0.00011413364357367122,
+   0.00011363531500580067, -0.00011313874767644891, 0.00011264393641385358, -0.00011215087606320923,
+   0.00011165956148656491, -0.00011116998756272247, 0.00011068214918713778, -0.00011019604127181927,
+   0.00010971165874523034, -0.00010922899655219122, 0.00010874804965378202, -0.00010826881302724613,
+   0.00010779128166589475, -0.00010731545057901248, 0.00010684131479176309, -0.00010636886934509696,
+   0.00010589810929565785, -0.00010542902971569186, 0.00010496162569295663, -0.00010449589233063115,
+   0.00010403182474722598, -0.00010356941807649535, 0.00010310866746734886, -0.0001026495680837645,
+   0.0001021921151047021, -0.00010173630372401763, 0.00010128212915037846, -0.0001008295866071785,
+   0.00010037867133245513, -9.9929378578806119e-05, 9.9481703613307366e-05, -9.903564171743119e-05,
+   9.8591188186965717e-05, -9.8148338331934567e-05, 9.7707087476517191e-05, -9.7267430958970078e-05,
+   9.682936413154877e-05, -9.6392882360429887e-05, 9.595798102563386e-05, -9.5524655520949495e-05,
+   9.5092901253857788e-05, -9.4662713645456907e-05, 9.4234088130387204e-05, -9.3807020156758713e-05,
+   9.338150518607649e-05, -9.2957538693168887e-05, 9.253511616611516e-05, -9.2114233106173801e-05,
+   9.1694885027712595e-05, -9.1277067458137411e-05, 9.0860775937822764e-05, -9.0446006020042857e-05,
+   9.003275327090356e-05, -8.9621013269272808e-05, 8.921078160671519e-05, -8.8802053887423557e-05,
+   8.8394825728153707e-05, -8.7989092758157764e-05, 8.7584850619119785e-05, -8.718209496509054e-05,
+   8.6780821462423196e-05, -8.6381025789710576e-05, 8.5982703637720929e-05, -8.5585850709336296e-05,
+   8.5190462719489667e-05, -8.4796535395103881e-05, 8.4404064475030783e-05, -8.401304570998965e-05,
+   8.3623474862508794e-05, -8.3235347706864235e-05, 8.2848660029021865e-05, -8.2463407626578433e-05,
+   8.2079586308703124e-05, -8.1697191896080868e-05, 8.1316220220854009e-05, -8.0936667126566472e-05,
+   8.055852846810742e-05, -8.0181800111655014e-05, 7.9806477934621703e-05, -7.9432557825599224e-05,
+   7.9060035684303865e-05, -7.8688907421523097e-05, 7.8319168959061538e-05, -7.7950816229688396e-05,
+   7.7583845177084208e-05, -7.7218251755789411e-05, 7.6854031931152092e-05, -7.6491181679276614e-05,
+   7.6129696986972859e-05, -7.5769573851706075e-05, 7.5410808281545981e-05, -7.5053396295117789e-05,
+   7.4697333921552796e-05, -7.434261720043929e-05, 7.3989242181774349e-05, -7.3637204925915809e-05,
+   7.328650150353426e-05, -7.2937127995566115e-05, 7.2589080493166717e-05, -7.2242355097663626e-05,
+   7.1896947920510766e-05, -7.1552855083242489e-05, 7.121007271742822e-05, -7.0868596964627782e-05,
+   7.0528423976346286e-05, -7.0189549913990282e-05, 6.985197094882383e-05, -6.9515683261924647e-05,
+   6.9180683044141265e-05, -6.8846966496050426e-05, 6.8514529827913844e-05, -6.8183369259636981e-05,
+   6.7853481020726603e-05, -6.7524861350249927e-05, 6.7197506496792994e-05, -6.6871412718420546e-05,
+   6.6546576282634727e-05, -6.6222993466336043e-05, 6.5900660555782858e-05, -6.5579573846552325e-05,
+   6.5259729643501224e-05, -6.4941124260727156e-05, 6.4623754021530036e-05, -6.4307615258373918e-05,
+   6.3992704312849653e-05, -6.3679017535636691e-05, 6.3366551286466106e-05, -6.3055301934084057e-05,
+   6.274526585621463e-05, -6.2436439439523883e-05, 6.2128819079583861e-05, -6.1822401180836793e-05,
+   6.1517182156559666e-05, -6.1213158428828973e-05, 6.0910326428486358e-05, -6.0608682595103494e-05,
+   6.0308223376948346e-05, -6.0008945230950638e-05, 5.971084462266871e-05, -5.9413918026255683e-05,
+   5.911816192442672e-05, -5.8823572808425416e-05, 5.8530147177992203e-05, -5.8237881541331074e-05,
+   5.79467724150783e-05, -5.7656816324269837e-05, 5.7368009802310632e-05, -5.7080349390942429e-05,
+   5.6793831640213465e-05, -5.6508453108447418e-05, 5.6224210362212874e-05, -5.5941099976293017e-05,
+   5.5659118533655449e-05, -5.5378262625423128e-05, 5.5098528850843807e-05, -5.4819913817261619e-05,
+   5.4542414140087316e-05, -5.4266026442770152e-05, 5.3990747356768698e-05, -5.3716573521522874e-05,
+   5.3443501584425554e-05, -5.3171528200795083e-05, 5.290065003384725e-05, -5.2630863754667809e-05,
+   5.2362166042185851e-05, -5.2094553583146181e-05, 5.1828023072082906e-05, -5.1562571211292681e-05,
+   5.129819471080867e-05, -5.1034890288374231e-05, 5.0772654669417033e-05, -5.0511484587023338e-05,
+   5.0251376781913013e-05, -4.9992328002413186e-05, 4.9734335004434514e-05, -4.9477394551445261e-05,
+   4.9221503414447215e-05, -4.8966658371951159e-05, 4.8712856209952388e-05, -4.8460093721907039e-05,
+   4.8208367708707839e-05, -4.7957674978660673e-05, 4.77080123474612e-05, -4.7459376638171356e-05,
+   4.7211764681196313e-05, -4.6965173314261748e-05, 4.6719599382390879e-05, -4.6475039737882233e-05,
+   4.6231491240286986e-05, -4.5988950756387228e-05, 4.5747415160173364e-05, -4.5506881332822804e-05,
+   4.5267346162678334e-05, -4.5028806545226348e-05, 4.4791259383075733e-05, -4.4554701585936916e-05,
+   4.4319130070600619e-05, -4.4084541760917513e-05, 4.3850933587777102e-05, -4.3618302489087748e-05,
+   4.3386645409756226e-05, -4.3155959301667416e-05, 4.2926241123664935e-05, -4.2697487841530649e-05,
+   4.2469696427965565e-05, -4.2242863862570229e-05, 4.2016987131825329e-05, -4.179206322907273e-05,
+   4.1568089154496264e-05, -4.1345061915103095e-05, 4.1122978524704811e-05, -4.0901836003899164e-05,
+   4.0681631380051396e-05, -4.0462361687276178e-05, 4.0244023966419449e-05, -4.0026615265040521e-05,
+   3.9810132637394056e-05, -3.9594573144412844e-05, 3.9379933853689761e-05, -3.9166211839460637e-05,
+   3.895340418258715e-05, -3.8741507970539324e-05, 3.8530520297379181e-05, -3.8320438263742991e-05,
+   3.8111258976825494e-05, -3.7902979550362689e-05, 3.7695597104615796e-05, -3.7489108766354701e-05,
+   3.7283511668841691e-05, -3.7078802951815748e-05, 3.6874979761476403e-05, -3.6672039250467843e-05,
+   3.6469978577863401e-05, -3.6268794909149984e-05, 3.6068485416212557e-05, -3.586904727731875e-05,
+   3.5670477677104044e-05, -3.5472773806556241e-05, 3.5275932863000785e-05, -3.5079952050085768e-05,
+   3.4884828577767352e-05, -3.4690559662295093e-05, 3.4497142526197359e-05, -3.4304574398267112e-05,
+   3.4112852513547496e-05, -3.392197411331783e-05, 3.3731936445079303e-05, -3.3542736762541199e-05,
+   3.3354372325607187e-05, -3.3166840400361342e-05, 3.2980138259054581e-05, -3.2794263180091277e-05,
+   3.2609212448015694e-05, -3.2424983353498727e-05, 3.2241573193324658e-05, -3.205897927037815e-05,
+   3.1877198893631064e-05, -3.1696229378129618e-05, 3.1516068044981746e-05, -3.1336712221343926e-05,
+   3.1158159240409089e-05, -3.0980406441393675e-05, 3.0803451169525503e-05, -3.0627290776031112e-05,
+   3.0451922618123861e-05, -3.0277344058991368e-05, 3.0103552467783828e-05, -2.9930545219601837e-05,
+   2.9758319695484358e-05, -2.9586873282397368e-05, 2.9416203373221513e-05, -2.9246307366741082e-05,
+   2.9077182667632085e-05, -2.890882668645084e-05, 2.8741236839622765e-05, -2.8574410549430889e-05,
+   2.8408345244004737e-05, -2.8243038357309201e-05, 2.8078487329133341e-05, -2.7914689605079746e-05,
+   2.775164263655319e-05, -2.7589343880750203e-05, 2.7427790800648147e-05, -2.7266980864994488e-05,
+   2.7106911548296376e-05, -2.6947580330810135e-05, 2.6788984698530545e-05, -2.6631122143180786e-05,
+   2.6473990162202087e-05, -2.6317586258743339e-05, 2.6161907941651102e-05, -2.6006952725459476e-05,
+   2.5852718130380027e-05, -2.5699201682291984e-05, 2.5546400912732278e-05, -2.5394313358885675e-05,
+   2.5242936563575127e-05, -2.509226807525208e-05, 2.4942305447986859e-05, -2.4793046241459129e-05,
+   2.4644488020948407e-05, -2.4496628357324581e-05, 2.4349464827038693e-05, -2.4202995012113494e-05,
+   2.4057216500134352e-05, -2.3912126884239993e-05, 2.376772376311337e-05, -2.3624004740972662e-05,
+   2.3480967427562337e-05, -2.3338609438144067e-05, 2.3196928393487934e-05, -2.3055921919863701e-05,
+   2.2915587649031785e-05, -2.2775923218234809e-05, 2.2636926270188895e-05, -2.2498594453074866e-05,
+   2.2360925420530005e-05, -2.2223916831639299e-05, 2.2087566350927043e-05, -2.1951871648348691e-05,
+   2.1816830399282132e-05, -2.1682440284519763e-05, 2.1548698990259941e-05, -2.1415604208098993e-05,
+   2.1283153635023085e-05, -2.1151344973399942e-05, 2.1020175930970992e-05, -2.0889644220843273e-05,
+   2.0759747561481531e-05, -2.0630483676700316e-05, 2.0501850295656021e-05, -2.0373845152839226e-05,
+   2.024646598806676e-05, -2.0119710546474148e-05, 1.9993576578507811e-05, -1.9868061839917413e-05,
+   1.9743164091748362e-05, -1.9618881100334187e-05, 1.9495210637289009e-05, -1.9372150479500121e-05,
+   1.9249698409120506e-05, -1.9127852213561491e-05, 1.9006609685485289e-05, -1.8885968622797879e-05,
+   1.8765926828641481e-05, -1.8646482111387556e-05, 1.8527632284629392e-05, -1.8409375167175107e-05,
+   1.8291708583040399e-05, -1.8174630361441538e-05, 1.8058138336788241e-05, -1.7942230348676716e-05,
+   1.7826904241882558e-05, -1.7712157866354005e-05, 1.7597989077204742e-05, -1.7484395734707201e-05,
+   1.7371375704285754e-05, -1.7258926856509626e-05, 1.7147047067086414e-05, -1.7035734216855108e-05,
+   1.6924986191779423e-05, -1.6814800882941202e-05, 1.6705176186533557e-05, -1.6596110003854412e-05,
+   1.6487600241299745e-05, -1.6379644810357134e-05, 1.6272241627599066e-05, -1.6165388614676583e-05,
+   1.6059083698312614e-05, -1.5953324810295628e-05, 1.5848109887473088e-05, -1.5743436871745158e-05,
+   1.5639303710058175e-05, -1.5535708354398425e-05, 1.5432648761785617e-05, -1.5330122894266721e-05,
+   1.5228128718909716e-05, -1.512666420779712e-05, 1.5025727338019897e-05, -1.492531609167124e-05,
+   1.4825428455840298e-05, -1.4726062422605993e-05, 1.4627215989031033e-05, -1.4528887157155496e-05,
+   1.4431073933991019e-05, -1.4333774331514493e-05, 1.423698636666209e-05, -1.4140708061323195e-05,
+   1.4044937442334381e-05, -1.3949672541473418e-05, 1.3854911395453198e-05, -1.3760652045915917e-05,
+   1.3666892539426955e-05, -1.3573630927469082e-05, 1.3480865266436474e-05, -1.3388593617628797e-05,
+   1.3296814047245369e-05, -1.3205524626379336e-05, 1.31147234310117e-05, -1.3024408542005592e-05,
+   1.2934578045100428e-05, -1.2845230030906093e-05, 1.2756362594897204e-05, -1.266797383740732e-05,
+   1.258006186362315e-05, -1.249262478357886e-05, 1.2405660712150346e-05, -1.2319167769049507e-05,
+   1.223314407881855e-05, -1.2147587770824331e-05, 1.2062496979252646e-05, -1.1977869843102612e-05,
+   1.1893704506181015e-05, -1.18099991170966e-05, 1.1726751829254609e-05, -1.1643960800851016e-05,
+   1.156162419486704e-05, -1.1479740179063465e-05, 1.1398306925975155e-05, -1.1317322612905412e-05,
+   1.123678542192049e-05, -1.1156693539843984e-05, 1.1077045158251373e-05, -1.0997838473464394e-05,
+   1.0919071686545616e-05, -1.0840743003292893e-05, 1.0762850634233859e-05, -1.0685392794620489e-05,
+   1.0608367704423546e-05, -1.0531773588327141e-05, 1.0455608675723306e-05, -1.0379871200706452e-05,
+   1.030455940206802e-05, -1.0229671523290948e-05, 1.0155205812544301e-05, -1.0081160522677762e-05,
+   1.0007533911216322e-05, -9.9343242403547668e-06, 9.8615297769522937e-06, -9.7891487925271264e-06,
+   9.7171795632511296e-06, -9.6456203699443292e-06, 9.5744694980696452e-06, -9.5037252377273846e-06,
+   9.4333858836499469e-06, -9.3634497351964495e-06, 9.2939150963473011e-06, -9.2247802756988588e-06,
+   9.1560435864580835e-06, -9.0877033464371947e-06, 9.019757878048277e-06, -8.9522055082978978e-06,
+   8.8850445687818389e-06, -8.8182733956797262e-06, 8.7518903297496462e-06, -8.685893716322843e-06,
+   8.6202819052983675e-06, -8.5550532511377339e-06, 8.4902061128596086e-06, -8.4257388540344372e-06,
+   8.3616498427791652e-06, -8.2979374517518699e-06, 8.2346000581464477e-06, -8.1716360436872641e-06,
+   8.10904379462385e-06, -8.0468217017255951e-06, 7.984968160276394e-06, -7.923481570069302e-06,
+   7.8623603354012557e-06, -7.8016028650677005e-06, 7.741207572357356e-06, -7.6811728750467581e-06,
+   7.6214971953950569e-06, -7.5621789601386111e-06, 7.5032166004856875e-06, -7.4446085521111701e-06,
+   7.3863532551511755e-06, -7.3284491541977214e-06, 7.2708946982934734e-06, -7.2136883409263098e-06,
+   7.15682854002409e-06, -7.100313757949226e-06, 7.044142461493388e-06, -6.9883131218722137e-06,
+   6.932824214719861e-06, -6.877674220083738e-06, 6.8228616224191706e-06, -6.768384910583969e-06,
+   6.7142425778331668e-06, -6.6604331218136412e-06, 6.6069550445587118e-06, -6.5538068524828237e-06,
+   6.5009870563762187e-06, -6.4484941713994467e-06, 6.3963267170781518e-06, -6.3444832172975673e-06,
+   6.292962200297222e-06, -6.2417621986655159e-06, 6.190881749334357e-06, -6.1403193935737689e-06,
+   6.0900736769864852e-06, -6.0401431495025528e-06, 5.9905263653739789e-06, -5.9412218831692252e-06,
+   5.8922282657679112e-06, -5.8435440803553217e-06, 5.7951678984170022e-06, -5.7470982957333678e-06,
+   5.6993338523742304e-06, -5.6518731526933855e-06, 5.604714785323163e-06, -5.5578573431690209e-06,
+   5.5112994234040078e-06, -5.4650396274634109e-06, 5.419076561039223e-06, -5.373408834074697e-06,
+   5.3280350607588646e-06, -5.2829538595211062e-06, 5.2381638530255839e-06, -5.1936636681658116e-06,
+   5.1494519360591438e-06, -5.10552729204127e-06, 5.0618883756607141e-06, -5.0185338306732891e-06,
+   4.9754623050366266e-06, -4.9326724509046109e-06, 4.8901629246218382e-06, -4.8479323867181181e-06,
+   4.8059795019028985e-06, -4.7643029390596845e-06, 4.7229013712405295e-06, -4.6817734756604454e-06,
+   4.6409179336918163e-06, -4.6003334308588297e-06, 4.5600186568318841e-06, -4.5199723054219814e-06,
+   4.4801930745751514e-06, -4.4406796663668087e-06, 4.4014307869961603e-06, -4.3624451467805553e-06,
+   4.3237214601498851e-06, -4.2852584456409052e-06, 4.247054825891616e-06, -4.2091093276355954e-06,
+   4.1714206816963309e-06, -4.1339876229815603e-06, 4.0968088904775861e-06, -4.059883227243589e-06,
+   4.0232093804059249e-06, -3.9867861011524405e-06, 3.9506121447267618e-06, -3.9146862704225427e-06,
+   3.8790072415777865e-06, -3.8435738255690725e-06, 3.808384793805832e-06, -3.7734389217245945e-06,
+   3.7387349887832202e-06, -3.7042717784551423e-06, 3.6700480782236092e-06, -3.6360626795758296e-06,
+   3.602314377997279e-06, -3.5688019729658238e-06, 3.5355242679459239e-06, -3.5024800703828536e-06,
+   3.4696681916968336e-06, -3.4370874472772085e-06, 3.4047366564766044e-06, -3.3726146426050853e-06,
+   3.3407202329242702e-06, -3.3090522586414827e-06, 3.2776095549038662e-06, -3.2463909607924923e-06,
+   3.2153953193164687e-06, -3.1846214774070348e-06, 3.1540682859116464e-06, -3.1237345995880561e-06,
+   3.0936192770983781e-06, -3.0637211810031481e-06, 3.0340391777553749e-06, -3.0045721376945895e-06,
+   2.9753189350408557e-06, -2.9462784478888255e-06, 2.9174495582017364e-06, -2.8888311518054074e-06,
+   2.860422118382264e-06, -2.8322213514652996e-06, 2.804227748432072e-06, -2.7764402104986595e-06,
+   2.7488576427136409e-06, -2.721478953952026e-06, 2.6943030569092075e-06, -2.6673288680949062e-06,
+   2.6405553078270747e-06, -2.6139813002258277e-06, 2.587605773207344e-06, -2.5614276584777625e-06,
+   2.5354458915270832e-06, -2.50965941162302e-06, 2.484067161804898e-06, -2.4586680888774983e-06,
+   2.4334611434049172e-06, -2.4084452797044097e-06, 2.3836194558402125e-06, -2.3589826336173877e-06,
+   2.3345337785756158e-06, -2.3102718599830319e-06, 2.2861958508299815e-06, -2.262304727822847e-06,
+   2.2385974713778181e-06, -2.2150730656146408e-06, 2.1917304983504099e-06, -2.1685687610932951e-06,
+   2.1455868490362986e-06, -2.1227837610509839e-06, 2.1001584996812018e-06, -2.0777100711368113e-06,
+   2.0554374852873752e-06, -2.0333397556558644e-06, 2.0114158994123578e-06, -1.9896649373676965e-06,
+   1.9680858939671801e-06, -1.9466777972842166e-06, 1.9254396790139801e-06, -1.9043705744670473e-06,
+   1.8834695225630444e-06, -1.862735565824264e-06, 1.842167750369288e-06, -1.8217651259065996e-06,
+   1.8015267457281681e-06, -1.7814516667030607e-06, 1.7615389492710124e-06, -1.741787657436007e-06,
+   1.7221968587598248e-06, -1.7027656243556251e-06, 1.6834930288814769e-06, -1.6643781505339008e-06,
+   1.6454200710413977e-06, -1.6266178756579798e-06, 1.6079706531566736e-06, -1.5894774958230261e-06,
+   1.5711374994486059e-06, -1.5529497633244841e-06, 1.5349133902347219e-06, -1.5170274864498323e-06,
+   1.4992911617202499e-06, -1.4817035292697772e-06, 1.4642637057890403e-06, -1.4469708114289118e-06,
+   1.4298239697939565e-06, -1.4128223079358359e-06, 1.3959649563467378e-06, -1.3792510489527591e-06,
+   1.3626797231073241e-06, -1.3462501195845571e-06, 1.3299613825726672e-06, -1.3138126596673246e-06,
+   1.2978031018650134e-06, -1.2819318635564024e-06, 1.2661981025196718e-06, -1.2506009799138801e-06,
+   1.2351396602722738e-06, -1.2198133114956221e-06, 1.2046211048455322e-06, -1.1895622149377558e-06,
+   1.1746358197354901e-06, -1.1598411005426757e-06, 1.1451772419972765e-06, -1.1306434320645613e-06,
+   1.1162388620303737e-06, -1.1019627264943914e-06, 1.0878142233633916e-06, -1.0737925538444876e-06,
+   1.059896922438376e-06, -1.0461265369325707e-06, 1.0324806083946263e-06, -1.0189583511653573e-06,
+   1.0055589828520519e-06, -9.9228172432167558e-07, 9.7912579969406638e-07, -9.6609043633513111e-07,
+   9.5317486485002045e-07, -9.403783190763119e-07, 9.2770003607718053e-07, -9.1513925613455524e-07,
+   9.0269522274227613e-07, -8.9036718259924896e-07, 8.7815438560258298e-07, -8.6605608484072647e-07,
+   8.5407153658659995e-07, -8.4220000029071077e-07, 8.3044073857427838e-07, -8.1879301722233913e-07,
+   8.0725610517684576e-07, -7.9582927452977513e-07, 7.8451180051620389e-07, -7.7330296150740462e-07,
+   7.6220203900392184e-07, -7.5120831762863683e-07, 7.4032108511984147e-07, -7.2953963232429349e-07,
+   7.1886325319027199e-07, -7.0829124476062316e-07, 6.9782290716580638e-07, -6.8745754361692398e-07,
+   6.7719446039875873e-07, -6.6703296686279112e-07, 6.5697237542022657e-07, -6.4701200153499948e-07,
+   6.3715116371679051e-07, -6.2738918351401767e-07, 6.1772538550684726e-07, -6.0815909730017262e-07,
+   5.9868964951660848e-07, -5.8931637578946829e-07, 5.8003861275574073e-07, -5.7085570004905966e-07,
+   5.6176698029267374e-07, -5.5277179909240008e-07, 5.4386950502958518e-07, -5.350594496540558e-07,
+   5.2634098747706121e-07, -5.1771347596421784e-07, 5.0917627552844262e-07, -5.0072874952288797e-07,
+   4.9237026423386745e-07, -4.8410018887377769e-07, 4.7591789557401838e-07, -4.6782275937790536e-07,
+   4.5981415823357858e-07, -4.5189147298690974e-07, 4.4405408737440313e-07, -4.3630138801608925e-07,
+   4.2863276440842183e-07, -4.2104760891716572e-07, 4.1354531677027979e-07, -4.0612528605079667e-07,
+   3.9878691768970518e-07, -3.9152961545881958e-07, 3.8435278596365008e-07, -3.7725583863626835e-07,
+   3.7023818572817209e-07, -3.6329924230314106e-07, 3.5643842623009501e-07, -3.4965515817594349e-07,
+   3.429488615984376e-07, -3.3631896273901346e-07, 3.2976489061563494e-07, -3.2328607701563325e-07,
+   3.1688195648854305e-07, -3.1055196633893682e-07, 3.0429554661925365e-07, -2.9811214012262797e-07,
+   2.9200119237571311e-07, -2.8596215163150607e-07, 2.7999446886216288e-07, -2.7409759775181958e-07,
+   2.6827099468940378e-07, -2.6251411876144905e-07, 2.568264317449015e-07, -2.5120739809993006e-07,
+   2.4565648496273103e-07, -2.401731621383264e-07, 2.347569020933739e-07, -2.2940717994895668e-07,
+   2.2412347347338612e-07, -2.1890526307499366e-07, 2.1375203179492642e-07, -2.0866326529993575e-07,
+   2.0363845187516967e-07, -1.9867708241695973e-07, 1.937786504256078e-07, -1.8894265199817089e-07
+};
+
+alignas(64) constexpr float KEISER_W3200_A9_F32[1600] =
+{
+   0.636619508f, -0.212205797f, 0.127322644f, -0.0909438357f,
+   0.0707331598f, -0.0578716286f, 0.0489673279f, -0.0424373671f,
+   0.0374437459f, -0.033501301f, 0.0303096958f, -0.0276730638f,
+   0.0254582074f, -0.0235714f, 0.0219447687f, -0.020527957f,
+   0.0192828178f, -0.0181799196f, 0.0171961971f, -0.0163133144f,
+   0.0155165158f, -0.014793789f, 0.0141352573f, -0.013532727f,
+   0.0129793389f, -0.0124693131f, 0.0119977407f, -0.0115604261f,
+   0.0111537632f, -0.0107746348f, 0.0104203336f, -0.0100884931f,
+   0.00977704208f, -0.00948415417f, 0.00920821447f, -0.00894779153f,
+   0.00870160945f, -0.00846852921f, 0.00824752916f, -0.00803769287f,
+   0.00783819333f, -0.00764828315f, 0.0074672848f, -0.00729458453f,
+   0.00712962262f, -0.00697188871f, 0.00682091666f, -0.00667627901f,
+   0.00653758459f, -0.00640447298f, 0.00627661217f, -0.00615369715f,
+   0.00603544433f, -0.00592159294f, 0.00581190037f, -0.0057061417f,
+   0.0056041088f, -0.00550560653f, 0.00541045424f, -0.00531848287f,
+   0.00522953458f, -0.00514346221f, 0.00506012747f, -0.00497940136f,
+   0.00490116188f, -0.00482529588f, 0.00475169625f, -0.00468026195f,
+   0.00461089797f, -0.00454351539f, 0.00447802991f, -0.00441436144f,
+   0.00435243547f, -0.0042921803f, 0.00423352886f, -0.00417641783f,
+   0.00412078621f, -0.00406657718f, 0.0040137358f, -0.00396221131f,
+   0.00391195389f, -0.00386291766f, 0.00381505745f, -0.00376833137f,
+   0.00372269913f, -0.00367812254f, 0.00363456481f, -0.0035919908f,
+   0.00355036766f, -0.00350966305f, 0.00346984691f, -0.00343088992f,
+   0.00339276437f, -0.00335544348f, 0.00331890164f, -0.00328311441f,
+   0.00324805849f, -0.00321371132f, 0.00318005122f, -0.00314705772f,
+   0.00311471056f, -0.00308299111f, 0.00305188051f, -0.00302136154f,
+   0.00299141696f, -0.0029620307f, 0.00293318671f, -0.00290487008f,
+   0.00287706614f, -0.00284976116f, 0.00282294117f, -0.00279659312f,
+   0.00277070492f, -0.00274526398f, 0.00272025866f, -0.00269567803f,
+   0.00267151068f, -0.00264774612f, 0.00262437435f, -0.00260138558f,
+   0.00257877028f, -0.00255651888f, 0.00253462279f, -0.00251307338f,
+   0.00249186205f, -0.0024709811f, 0.00245042262f, -0.00243017869f,
+   0.00241024233f, -0.00239060633f, 0.00237126369f, -0.0023522079f,
+   0.00233343244f, -0.00231493101f, 0.00229669735f, -0.00227872562f,
+   0.00226101f, -0.00224354537f, 0.00222632568f, -0.00220934604f,
+   0.0021926011f, -0.00217608619f, 0.00215979619f, -0.00214372668f,
+   0.00212787278f, -0.00211223029f, 0.00209679478f, -0.0020815623f,
+   0.00206652819f, -0.0020516892f, 0.00203704066f, -0.00202257955f,
+   0.00200830167f, -0.00199420378f, 0.00198028237f, -0.00196653372f,
+   0.0019529548f, -0.00193954224f, 0.00192629313f, -0.00191320421f,
+   0.00190027256f, -0.00188749516f, 0.00187486934f, -0.0018623923f,
+   0.00185006124f, -0.00183787348f, 0.00182582659f, -0.00181391812f,
+   0.00180214539f, -0.00179050607f, 0.00177899795f, -0.00176761858f,
+   0.00175636588f, -0.0017452375f, 0.00173423148f, -0.0017233456f,
+   0.001712578f, -0.00170192646f, 0.00169138925f, -0.00168096425f,
+   0.00167064986f, -0.00166044408f, 0.00165034516f, -0.00164035137f,
+   0.00163046108f, -0.00162067253f, 0.00161098409f, -0.00160139427f,
+   0.00159190141f, -0.00158250402f, 0.00157320069f, -0.00156398979f,
+   0.00155486993f, -0.00154583983f, 0.00153689797f, -0.00152804307f,
+   0.00151927373f, -0.0015105888f, 0.00150198699f, -0.00149346702f,
+   0.00148502761f, -0.00147666759f, 0.00146838592f, -0.0014601812f,
+   0.00145205262f, -0.00144399889f, 0.00143601897f, -0.00142811181f,
+   0.00142027636f, -0.00141251157f, 0.00140481652f, -0.00139719015f,
+   0.00138963154f, -0.00138213974f, 0.00137471384f, -0.0013673529f,
+   0.00136005599f, -0.00135282241f, 0.00134565111f, -0.00133854127f,
+   0.00133149209f, -0.00132450287f, 0.00131757266f, -0.00131070067f,
+   0.0013038863f, -0.00129712862f, 0.00129042694f, -0.00128378056f,
+   0.00127718877f, -0.00127065077f, 0.00126416597f, -0.00125773356f,
+   0.00125135307f, -0.00124502368f, 0.00123874482f, -0.0012325159f,
+   0.00122633611f, -0.00122020498f, 0.00121412193f, -0.00120808627f,
+   0.00120209751f, -0.00119615498f, 0.00119025819f, -0.00118440657f,
+   0.00117859966f, -0.00117283664f, 0.00116711727f, -0.00116144097f,
+   0.00115580705f, -0.00115021528f, 0.00114466494f, -0.00113915571f,
+   0.00113368698f, -0.0011282583f, 0.00112286932f, -0.00111751945f,
+   0.00111220824f, -0.00110693544f, 0.00110170036f, -0.00109650264f,
+   0.00109134207f, -0.00108621793f, 0.00108112989f, -0.00107607769f,
+   0.00107106089f, -0.0010660789f, 0.0010611316f, -0.00105621852f,
+   0.0010513392f, -0.0010464933f, 0.00104168046f, -0.00103690044f,
+   0.0010321528f, -0.00102743716f, 0.00102275319f, -0.00101810065f,
+   0.00101347896f, -0.00100888812f, 0.00100432755f, -0.000999797136f,
+   0.000995296403f, -0.000990825123f, 0.000986382947f, -0.000981969526f,
+   0.000977584743f, -0.000973228074f, 0.000968899403f, -0.000964598439f,
+   0.000960324833f, -0.000956078293f, 0.000951858645f, -0.00094766554f,
+   0.000943498686f, -0.000939357909f, 0.000935242977f, -0.000931153481f,
+   0.000927089306f, -0.00092305016f, 0.000919035811f, -0.000915045966f,
+   0.000911080453f, -0.00090713898f, 0.000903221429f, -0.000899327395f,
+   0.000895456818f, -0.000891609408f, 0.000887784932f, -0.000883983157f,
+   0.000880203908f, -0.000876447011f, 0.000872712175f, -0.000868999225f,
+   0.000865307986f, -0.000861638226f, 0.000857989769f, -0.000854362384f,
+   0.000850755954f, -0.000847170188f, 0.000843604968f, -0.000840060122f,
+   0.000836535415f, -0.000833030674f, 0.000829545723f, -0.000826080446f,
+   0.000822634553f, -0.000819207984f, 0.000815800508f, -0.000812411949f,
+   0.000809042191f, -0.000805691059f, 0.000802358321f, -0.000799043919f,
+   0.000795747619f, -0.000792469305f, 0.000789208803f, -0.000785965996f,
+   0.00078274071f, -0.000779532769f, 0.000776342058f, -0.00077316846f,
+   0.000770011742f, -0.000766871846f, 0.000763748598f, -0.00076064188f,
+   0.000757551519f, -0.000754477456f, 0.000751419459f, -0.00074837741f,
+   0.000745351252f, -0.00074234081f, 0.000739345909f, -0.00073636655f,
+   0.000733402499f, -0.000730453641f, 0.000727519859f, -0.000724601094f,
+   0.00072169723f, -0.000718808034f, 0.000715933449f, -0.000713073416f,
+   0.00071022776f, -0.000707396423f, 0.000704579172f, -0.000701776065f,
+   0.000698986871f, -0.000696211471f, 0.000693449867f, -0.000690701883f,
+   0.000687967404f, -0.00068524637f, 0.000682538666f, -0.000679844175f,
+   0.000677162781f, -0.000674494426f, 0.00067183905f, -0.000669196423f,
+   0.000666566542f, -0.000663949351f, 0.000661344675f, -0.000658752397f,
+   0.000656172575f, -0.000653604977f, 0.000651049544f, -0.000648506219f,
+   0.000645974884f, -0.000643455482f, 0.000640947896f, -0.000638452068f,
+   0.000635967939f, -0.000633495336f, 0.000631034258f, -0.000628584588f,
+   0.000626146269f, -0.000623719185f, 0.000621303276f, -0.000618898484f,
+   0.000616504694f, -0.000614121847f, 0.000611749885f, -0.000609388691f,
+   0.000607038208f, -0.000604698376f, 0.000602369139f, -0.000600050378f,
+   0.000597742095f, -0.000595444115f, 0.000593156437f, -0.000590878946f,
+   0.000588611641f, -0.000586354407f, 0.000584107183f, -0.000581869914f,
+   0.000579642539f, -0.000577424944f, 0.000575217127f, -0.000573018973f,
+   0.000570830482f, -0.000568651478f, 0.00056648202f, -0.000564321992f,
+   0.000562171335f, -0.00056003005f, 0.000557897962f, -0.00055577507f,
+   0.000553661317f, -0.000551556644f, 0.000549460994f, -0.000547374249f,
+   0.000545296469f, -0.000543227536f, 0.000541167392f, -0.000539115979f,
+   0.000537073298f, -0.000535039173f, 0.000533013663f, -0.000530996709f,
+   0.000528988137f, -0.000526988064f, 0.000524996314f, -0.000523012946f,
+   0.000521037786f, -0.000519070833f, 0.000517112087f, -0.000515161431f,
+   0.000513218809f, -0.000511284277f, 0.000509357662f, -0.000507438963f,
+   0.00050552818f, -0.000503625197f, 0.000501730014f, -0.000499842572f,
+   0.000497962814f, -0.000496090739f, 0.000494226231f, -0.000492369232f,
+   0.0004905198f, -0.000488677877f, 0.000486843317f, -0.000485016149f,
+   0.000483196316f, -0.000481383817f, 0.000479578564f, -0.000477780501f,
+   0.000475989655f, -0.00047420591f, 0.000472429267f, -0.000470659696f,
+   0.000468897109f, -0.000467141508f, 0.000465392863f, -0.000463651086f,
+   0.000461916206f, -0.000460188108f, 0.00045846682f, -0.000456752285f,
+   0.000455044443f, -0.000453343266f, 0.000451648753f, -0.000449960819f,
+   0.000448279461f, -0.000446604623f, 0.000444936275f, -0.000443274417f,
+   0.000441618962f, -0.000439969881f, 0.000438327173f, -0.000436690781f,
+   0.000435060705f, -0.000433436857f, 0.000431819237f, -0.000430207816f,
+   0.000428602536f, -0.000427003397f, 0.000425410341f, -0.000423823338f,
+   0.000422242389f, -0.000420667406f, 0.000419098418f, -0.000417535368f,
+   0.000415978226f, -0.000414426933f, 0.00041288152f, -0.000411341898f,
+   0.000409808068f, -0.00040828003f, 0.000406757696f, -0.000405241037f,
+   0.000403730082f, -0.000402224774f, 0.000400725054f, -0.00039923095f,
+   0.000397742406f, -0.000396259362f, 0.000394781848f, -0.000393309805f,
+   0.000391843234f, -0.000390382047f, 0.000388926303f, -0.000387475884f,
+   0.00038603085f, -0.000384591112f, 0.000383156672f, -0.000381727499f,
+   0.000380303594f, -0.00037888487f, 0.000377471355f, -0.000376063021f,
+   0.000374659809f, -0.000373261719f, 0.000371868751f, -0.000370480819f,
+   0.00036909795f, -0.000367720117f, 0.00036634726f, -0.000364979409f,
+   0.000363616477f, -0.000362258492f, 0.000360905426f, -0.000359557249f,
+   0.000358213903f, -0.000356875418f, 0.000355541764f, -0.000354212883f,
+   0.000352888776f, -0.000351569441f, 0.000350254821f, -0.000348944915f,
+   0.000347639696f, -0.000346339162f, 0.000345043256f, -0.000343751977f,
+   0.000342465297f, -0.000341183215f, 0.000339905673f, -0.000338632701f,
+   0.000337364239f, -0.000336100289f, 0.000334840821f, -0.000333585835f,
+   0.000332335272f, -0.000331089133f, 0.000329847389f, -0.000328610069f,
+   0.000327377085f, -0.000326148467f, 0.000324924156f, -0.000323704182f,
+   0.000322488486f, -0.000321277097f, 0.000320069928f, -0.000318867009f,
+   0.000317668309f, -0.000316473801f, 0.000315283512f, -0.000314097357f,
+   0.000312915363f, -0.000311737502f, 0.000310563744f, -0.00030939409f,
+   0.00030822854f, -0.000307067035f, 0.000305909576f, -0.000304756133f,
+   0.000303606736f, -0.000302461296f, 0.000301319873f, -0.000300182379f,
+   0.000299048872f, -0.000297919265f, 0.000296793587f, -0.000295671809f,
+   0.000294553902f, -0.000293439894f, 0.0002923297f, -0.000291223376f,
+   0.000290120865f, -0.000289022137f, 0.000287927222f, -0.00028683609f,
+   0.000285748712f, -0.00028466506f, 0.000283585163f, -0.000282508961f,
+   0.000281436485f, -0.000280367676f, 0.000279302563f, -0.000278241088f,
+   0.000277183251f, -0.000276129053f, 0.000275078492f, -0.00027403151f,
+   0.000272988109f, -0.000271948316f, 0.000270912045f, -0.000269879325f,
+   0.000268850155f, -0.000267824507f, 0.000266802352f, -0.000265783689f,
+   0.000264768518f, -0.000263756781f, 0.000262748537f, -0.000261743699f,
+   0.000260742294f, -0.000259744324f, 0.000258749729f, -0.00025775854f,
+   0.000256770727f, -0.000255786261f, 0.000254805142f, -0.000253827369f,
+   0.000252852944f, -0.000251881807f, 0.000250913959f, -0.000249949429f,
+   0.000248988159f, -0.000248030148f, 0.000247075397f, -0.000246123876f,
+   0.000245175615f, -0.000244230527f, 0.000243288669f, -0.000242349997f,
+   0.000241414513f, -0.000240482201f, 0.000239553032f, -0.000238627021f,
+   0.000237704153f, -0.000236784399f, 0.000235867759f, -0.000234954219f,
+   0.000234043779f, -0.000233136408f, 0.000232232109f, -0.000231330865f,
+   0.000230432677f, -0.000229537531f, 0.000228645396f, -0.000227756274f,
+   0.000226870165f, -0.000225987053f, 0.000225106924f, -0.000224229763f,
+   0.000223355557f, -0.000222484319f, 0.000221616006f, -0.000220750633f,
+   0.000219888185f, -0.000219028647f, 0.000218172005f, -0.000217318258f,
+   0.000216467393f, -0.000215619395f, 0.000214774263f, -0.000213931984f,
+   0.000213092542f, -0.000212255924f, 0.000211422142f, -0.00021059117f,
+   0.000209762991f, -0.000208937621f, 0.000208115016f, -0.000207295205f,
+   0.000206478144f, -0.000205663848f, 0.000204852302f, -0.000204043492f,
+   0.000203237403f, -0.000202434036f, 0.000201633375f, -0.00020083542f,
+   0.000200040158f, -0.000199247574f, 0.000198457667f, -0.000197670422f,
+   0.000196885827f, -0.000196103894f, 0.000195324596f, -0.000194547916f,
+   0.000193773871f, -0.00019300243f, 0.000192233594f, -0.000191467363f,
+   0.000190703708f, -0.000189942642f, 0.000189184138f, -0.000188428196f,
+   0.000187674799f, -0.000186923964f, 0.000186175646f, -0.000185429875f,
+   0.000184686607f, -0.000183945871f, 0.000183207623f, -0.000182471878f,
+   0.000181738622f, -0.000181007839f, 0.00018027953f, -0.000179553681f,
+   0.000178830291f, -0.000178109345f, 0.000177390844f, -0.000176674774f,
+   0.000175961133f, -0.000175249908f, 0.000174541085f, -0.000173834662f,
+   0.00017313064f, -0.000172429005f, 0.000171729742f, -0.000171032865f,
+   0.000170338331f, -0.00016964617f, 0.000168956351f, -0.00016826886f,
+   0.000167583727f, -0.000166900907f, 0.000166220401f, -0.000165542209f,
+   0.000164866331f, -0.000164192752f, 0.000163521458f, -0.000162852433f,
+   0.000162185708f, -0.000161521239f, 0.000160859025f, -0.000160199081f,
+   0.000159541378f, -0.000158885916f, 0.00015823268f, -0.000157581686f,
+   0.000156932903f, -0.000156286333f, 0.000155641974f, -0.000154999812f,
+   0.000154359834f, -0.000153722052f, 0.000153086454f, -0.000152453023f,
+   0.000151821747f, -0.000151192638f, 0.000150565684f, -0.000149940883f,
+   0.000149318206f, -0.000148697669f, 0.000148079271f, -0.000147462968f,
+   0.000146848804f, -0.000146236736f, 0.000145626764f, -0.000145018887f,
+   0.000144413105f, -0.00014380939f, 0.00014320777f, -0.000142608202f,
+   0.0001420107f, -0.000141415265f, 0.000140821867f, -0.000140230521f,
+   0.000139641212f, -0.000139053926f, 0.000138468677f, -0.00013788545f,
+   0.000137304232f, -0.000136725008f, 0.000136147806f, -0.000135572584f,
+   0.000134999354f, -0.000134428119f, 0.000133858848f, -0.000133291556f,
+   0.000132726229f, -0.000132162852f, 0.000131601439f, -0.000131041961f,
+   0.000130484448f, -0.000129928856f, 0.000129375199f, -0.000128823463f,
+   0.000128273648f, -0.00012772574f, 0.000127179752f, -0.000126635656f,
+   0.000126093466f, -0.000125553153f, 0.000125014732f, -0.000124478189f,
+   0.000123943522f, -0.000123410733f, 0.000122879792f, -0.000122350713f,
+   0.00012182349f, -0.000121298108f, 0.000120774574f, -0.000120252866f,
+   0.000119732998f, -0.00011921495f, 0.000118698721f, -0.000118184304f,
+   0.000117671698f, -0.000117160889f, 0.000116651885f, -0.000116144671f,
+   0.000115639246f, -0.000115135605f, 0.000114633738f, -0.000114133647f,
+   0.000113635317f, -0.000113138747f, 0.000112643938f, -0.000112150876f,
+   0.000111659559f, -0.000111169989f, 0.000110682151f, -0.000110196044f,
+   0.000109711662f, -0.000109228997f, 0.000108748049f, -0.00010826881f,
+   0.000107791282f, -0.000107315449f, 0.000106841311f, -0.000106368869f,
+   0.000105898107f, -0.000105429033f, 0.000104961626f, -0.000104495892f,
+   0.000104031824f, -0.000103569415f, 0.000103108665f, -0.000102649567f,
+   0.000102192113f, -0.000101736303f, 0.00010128213f, -0.000100829588f,
+   0.000100378675f, -9.9929377e-05f, 9.94817019e-05f, -9.90356421e-05f,
+   9.85911902e-05f, -9.8148339e-05f, 9.77070886e-05f, -9.72674316e-05f,
+   9.68293607e-05f, -9.63928833e-05f, 9.59579775e-05f, -9.55246578e-05f,
+   9.50929025e-05f, -9.46627115e-05f, 9.42340848e-05f, -9.38070225e-05f,
+   9.33815027e-05f, -9.29575399e-05f, 9.25351196e-05f, -9.21142346e-05f,
+   9.16948848e-05f, -9.12770702e-05f, 9.08607763e-05f, -9.0446003e-05f,
+   9.00327504e-05f, -8.96210113e-05f, 8.92107782e-05f, -8.88020513e-05f,
+   8.83948233e-05f, -8.7989094e-05f, 8.75848491e-05f, -8.71820957e-05f,
+   8.67808194e-05f, -8.63810274e-05f, 8.59827051e-05f, -8.55858525e-05f,
+   8.51904624e-05f, -8.47965348e-05f, 8.44040624e-05f, -8.40130451e-05f,
+   8.36234758e-05f, -8.32353471e-05f, 8.28486591e-05f, -8.24634044e-05f,
+   8.20795831e-05f, -8.16971951e-05f, 8.13162187e-05f, -8.09366684e-05f,
+   8.05585296e-05f, -8.01818023e-05f, 7.98064793e-05f, -7.94325606e-05f,
+   7.90600388e-05f, -7.86889068e-05f, 7.83191717e-05f, -7.79508191e-05f,
+   7.75838416e-05f, -7.72182539e-05f, 7.6854034e-05f, -7.6491182e-05f,
+   7.61296978e-05f, -7.57695743e-05f, 7.54108114e-05f, -7.50533945e-05f,
+   7.4697331e-05f, -7.43426208e-05f, 7.39892421e-05f, -7.36372021e-05f,
+   7.3286501e-05f, -7.29371313e-05f, 7.25890786e-05f, -7.22423574e-05f,
+   7.18969459e-05f, -7.15528586e-05f, 7.12100737e-05f, -7.08685984e-05f,
+   7.05284256e-05f, -7.01895478e-05f, 6.98519725e-05f, -6.9515685e-05f,
+   6.91806854e-05f, -6.88469663e-05f, 6.85145278e-05f, -6.81833699e-05f,
+   6.7853478e-05f, -6.75248593e-05f, 6.71975067e-05f, -6.68714129e-05f,
+   6.65465777e-05f, -6.62229941e-05f, 6.59006619e-05f, -6.55795739e-05f,
+   6.525973e-05f, -6.49411231e-05f, 6.46237531e-05f, -6.43076128e-05f,
+   6.39927021e-05f, -6.3679021e-05f, 6.33665477e-05f, -6.30553041e-05f,
+   6.27452682e-05f, -6.24364402e-05f, 6.212882e-05f, -6.18224003e-05f,
+   6.15171812e-05f, -6.12131553e-05f, 6.09103263e-05f, -6.06086833e-05f,
+   6.03082226e-05f, -6.00089443e-05f, 5.97108447e-05f, -5.94139165e-05f,
+   5.91181633e-05f, -5.88235744e-05f, 5.85301459e-05f, -5.82378816e-05f,
+   5.79467742e-05f, -5.76568164e-05f, 5.73680081e-05f, -5.70803495e-05f,
+   5.67938332e-05f, -5.6508452e-05f, 5.62242094e-05f, -5.59410983e-05f,
+   5.56591185e-05f, -5.53782629e-05f, 5.50985278e-05f, -5.48199132e-05f,
+   5.45424155e-05f, -5.42660273e-05f, 5.39907487e-05f, -5.37165724e-05f,
+   5.34435021e-05f, -5.31715268e-05f, 5.29006502e-05f, -5.2630865e-05f,
+   5.23621675e-05f, -5.20945541e-05f, 5.18280249e-05f, -5.15625725e-05f,
+   5.12981933e-05f, -5.10348909e-05f, 5.07726545e-05f, -5.0511484e-05f,
+   5.02513758e-05f, -4.99923262e-05f, 4.97343353e-05f, -4.94773958e-05f,
+   4.9221504e-05f, -4.896666e-05f, 4.87128564e-05f, -4.84600932e-05f,
+   4.82083669e-05f, -4.79576738e-05f, 4.77080139e-05f, -4.74593762e-05f,
+   4.72117645e-05f, -4.6965175e-05f, 4.67196005e-05f, -4.6475041e-05f,
+   4.62314929e-05f, -4.59889525e-05f, 4.57474162e-05f, -4.55068803e-05f,
+   4.52673448e-05f, -4.50288062e-05f, 4.47912607e-05f, -4.45547012e-05f,
+   4.43191311e-05f, -4.40845433e-05f, 4.38509342e-05f, -4.36183036e-05f,
+   4.33866444e-05f, -4.31559602e-05f, 4.292624e-05f, -4.26974875e-05f,
+   4.24696955e-05f, -4.22428639e-05f, 4.20169854e-05f, -4.17920637e-05f,
+   4.15680879e-05f, -4.13450616e-05f, 4.11229776e-05f, -4.09018357e-05f,
+   4.06816325e-05f, -4.04623606e-05f, 4.02440237e-05f, -4.00266144e-05f,
+   3.98101329e-05f, -3.95945717e-05f, 3.93799346e-05f, -3.91662106e-05f,
+   3.89534034e-05f, -3.87415093e-05f, 3.85305211e-05f, -3.83204388e-05f,
+   3.81112586e-05f, -3.79029807e-05f, 3.76955977e-05f, -3.74891097e-05f,
+   3.72835129e-05f, -3.70788039e-05f, 3.68749788e-05f, -3.66720378e-05f,
+   3.64699772e-05f, -3.62687933e-05f, 3.60684862e-05f, -3.58690486e-05f,
+   3.56704768e-05f, -3.54727745e-05f, 3.52759344e-05f, -3.50799528e-05f,
+   3.48848298e-05f, -3.46905581e-05f, 3.44971413e-05f, -3.43045758e-05f,
+   3.41128507e-05f, -3.39219732e-05f, 3.37319361e-05f, -3.35427358e-05f,
+   3.33543721e-05f, -3.31668416e-05f, 3.29801369e-05f, -3.27942616e-05f,
+   3.26092122e-05f, -3.2424985e-05f, 3.22415726e-05f, -3.20589788e-05f,
+   3.18771999e-05f, -3.16962287e-05f, 3.15160687e-05f, -3.13367127e-05f,
+   3.11581607e-05f, -3.09804054e-05f, 3.08034505e-05f, -3.06272923e-05f,
+   3.04519235e-05f, -3.02773442e-05f, 3.01035525e-05f, -2.99305448e-05f,
+   2.97583192e-05f, -2.9586874e-05f, 2.94162037e-05f, -2.92463083e-05f,
+   2.90771823e-05f, -2.89088275e-05f, 2.87412367e-05f, -2.857441e-05f,
+   2.84083453e-05f, -2.82430392e-05f, 2.8078488e-05f, -2.79146898e-05f,
+   2.77516428e-05f, -2.75893435e-05f, 2.742779e-05f, -2.72669804e-05f,
+   2.71069111e-05f, -2.69475804e-05f, 2.67889845e-05f, -2.66311217e-05f,
+   2.64739901e-05f, -2.63175862e-05f, 2.6161908e-05f, -2.60069519e-05f,
+   2.5852718e-05f, -2.56992025e-05f, 2.55464001e-05f, -2.53943126e-05f,
+   2.52429363e-05f, -2.50922676e-05f, 2.49423047e-05f, -2.47930457e-05f,
+   2.46444888e-05f, -2.44966286e-05f, 2.43494651e-05f, -2.42029946e-05f,
+   2.40572172e-05f, -2.39121273e-05f, 2.37677232e-05f, -2.36240048e-05f,
+   2.34809668e-05f, -2.3338609e-05f, 2.31969279e-05f, -2.30559217e-05f,
+   2.29155885e-05f, -2.27759228e-05f, 2.26369266e-05f, -2.24985943e-05f,
+   2.23609259e-05f, -2.22239159e-05f, 2.20875663e-05f, -2.19518715e-05f,
+   2.18168298e-05f, -2.1682441e-05f, 2.15486998e-05f, -2.14156044e-05f,
+   2.12831528e-05f, -2.11513452e-05f, 2.10201761e-05f, -2.08896436e-05f,
+   2.07597477e-05f, -2.0630483e-05f, 2.05018496e-05f, -2.03738455e-05f,
+   2.02464653e-05f, -2.01197108e-05f, 1.99935766e-05f, -1.98680627e-05f,
+   1.97431636e-05f, -1.96188812e-05f, 1.94952099e-05f, -1.93721498e-05f,
+   1.92496991e-05f, -1.91278523e-05f, 1.90066094e-05f, -1.88859685e-05f,
+   1.87659261e-05f, -1.86464822e-05f, 1.85276331e-05f, -1.84093751e-05f,
+   1.82917083e-05f, -1.81746309e-05f, 1.80581392e-05f, -1.79422295e-05f,
+   1.78269038e-05f, -1.77121583e-05f, 1.75979894e-05f, -1.74843954e-05f,
+   1.73713761e-05f, -1.72589262e-05f, 1.71470474e-05f, -1.70357343e-05f,
+   1.6924987e-05f, -1.68148017e-05f, 1.67051767e-05f, -1.65961101e-05f,
+   1.64876001e-05f, -1.63796449e-05f, 1.62722408e-05f, -1.61653879e-05f,
+   1.60590844e-05f, -1.59533247e-05f, 1.58481107e-05f, -1.5743437e-05f,
+   1.56393035e-05f, -1.55357084e-05f, 1.54326481e-05f, -1.53301226e-05f,
+   1.52281291e-05f, -1.5126664e-05f, 1.50257274e-05f, -1.49253165e-05f,
+   1.48254285e-05f, -1.47260625e-05f, 1.46272159e-05f, -1.45288868e-05f,
+   1.44310743e-05f, -1.43337747e-05f, 1.42369863e-05f, -1.41407081e-05f,
+   1.40449374e-05f, -1.39496724e-05f, 1.38549112e-05f, -1.37606521e-05f,
+   1.36668923e-05f, -1.35736309e-05f, 1.34808652e-05f, -1.33885933e-05f,
+   1.32968144e-05f, -1.32055247e-05f, 1.31147235e-05f, -1.30244089e-05f,
+   1.29345781e-05f, -1.28452302e-05f, 1.27563626e-05f, -1.26679743e-05f,
+   1.25800616e-05f, -1.24926246e-05f, 1.24056605e-05f, -1.23191676e-05f,
+   1.22331439e-05f, -1.21475878e-05f, 1.20624973e-05f, -1.19778697e-05f,
+   1.18937041e-05f, -1.18099988e-05f, 1.17267518e-05f, -1.16439605e-05f,
+   1.1561624e-05f, -1.14797404e-05f, 1.13983069e-05f, -1.13173228e-05f,
+   1.12367852e-05f, -1.11566933e-05f, 1.10770452e-05f, -1.09978382e-05f,
+   1.09190714e-05f, -1.0840743e-05f, 1.07628503e-05f, -1.06853931e-05f,
+   1.0608368e-05f, -1.0531774e-05f, 1.04556084e-05f, -1.03798711e-05f,
+   1.03045595e-05f, -1.02296717e-05f, 1.01552059e-05f, -1.00811603e-05f,
+   1.0007534e-05f, -9.93432423e-06f, 9.86153009e-06f, -9.78914886e-06f,
+   9.71717964e-06f, -9.64562059e-06f, 9.57446991e-06f, -9.50372487e-06f,
+   9.43338546e-06f, -9.36344986e-06f, 9.29391535e-06f, -9.22478011e-06f,
+   9.15604323e-06f, -9.08770289e-06f, 9.01975818e-06f, -8.95220546e-06f,
+   8.88504474e-06f, -8.81827327e-06f, 8.75189016e-06f, -8.68589359e-06f,
+   8.62028173e-06f, -8.55505368e-06f, 8.4902058e-06f, -8.425739e-06f,
+   8.36164963e-06f, -8.29793771e-06f, 8.2346005e-06f, -8.17163618e-06f,
+   8.10904385e-06f, -8.04682168e-06f, 7.98496785e-06f, -7.92348146e-06f,
+   7.86236069e-06f, -7.80160281e-06f, 7.74120781e-06f, -7.68117297e-06f,
+   7.62149739e-06f, -7.56217878e-06f, 7.50321669e-06f, -7.4446084e-06f,
+   7.38635345e-06f, -7.3284491e-06f, 7.27089491e-06f, -7.21368815e-06f,
+   7.15682836e-06f, -7.10031372e-06f, 7.04414242e-06f, -6.98831309e-06f,
+   6.93282436e-06f, -6.87767442e-06f, 6.82286145e-06f, -6.76838499e-06f,
+   6.71424277e-06f, -6.66043297e-06f, 6.60695514e-06f, -6.553807e-06f,
+   6.50098718e-06f, -6.44849433e-06f, 6.39632663e-06f, -6.34448315e-06f,
+   6.2929621e-06f, -6.24176209e-06f, 6.19088178e-06f, -6.14031933e-06f,
+   6.09007384e-06f, -6.04014303e-06f, 5.99052646e-06f, -5.94122184e-06f,
+   5.89222827e-06f, -5.84354393e-06f, 5.79516791e-06f, -5.74709838e-06f,
+   5.699334e-06f, -5.65187338e-06f, 5.60471472e-06f, -5.55785755e-06f,
+   5.51129961e-06f, -5.46503952e-06f, 5.41907639e-06f, -5.37340884e-06f,
+   5.32803506e-06f, -5.28295368e-06f, 5.23816379e-06f, -5.19366358e-06f,
+   5.14945214e-06f, -5.10552718e-06f, 5.06188826e-06f, -5.01853401e-06f,
+   4.97546216e-06f, -4.93267225e-06f, 4.89016293e-06f, -4.84793236e-06f,
+   4.80597964e-06f, -4.76430296e-06f, 4.72290139e-06f, -4.68177359e-06f,
+   4.64091772e-06f, -4.60033334e-06f, 4.56001862e-06f, -4.51997221e-06f,
+   4.48019318e-06f, -4.44067973e-06f, 4.40143094e-06f, -4.362445e-06f,
+   4.32372144e-06f, -4.28525846e-06f, 4.24705468e-06f, -4.20910919e-06f,
+   4.17142064e-06f, -4.13398766e-06f, 4.09680888e-06f, -4.05988339e-06f,
+   4.02320939e-06f, -3.98678594e-06f, 3.95061215e-06f, -3.9146862e-06f,
+   3.87900718e-06f, -3.84357372e-06f, 3.80838469e-06f, -3.77343895e-06f,
+   3.7387349e-06f, -3.70427188e-06f, 3.67004805e-06f, -3.63606273e-06f,
+   3.60231434e-06f, -3.56880196e-06f, 3.53552423e-06f, -3.50248001e-06f,
+   3.46966817e-06f, -3.43708734e-06f, 3.40473662e-06f, -3.37261463e-06f,
+   3.34072024e-06f, -3.30905232e-06f, 3.27760949e-06f, -3.24639086e-06f,
+   3.21539528e-06f, -3.18462139e-06f, 3.15406828e-06f, -3.12373459e-06f,
+   3.09361917e-06f, -3.06372112e-06f, 3.03403908e-06f, -3.00457214e-06f,
+   2.97531892e-06f, -2.94627853e-06f, 2.91744959e-06f, -2.8888312e-06f,
+   2.86042223e-06f, -2.8322213e-06f, 2.80422773e-06f, -2.77644017e-06f,
+   2.7488577e-06f, -2.72147895e-06f, 2.69430302e-06f, -2.66732877e-06f,
+   2.64055529e-06f, -2.61398122e-06f, 2.58760588e-06f, -2.56142766e-06f,
+   2.5354459e-06f, -2.50965945e-06f, 2.48406718e-06f, -2.45866818e-06f,
+   2.43346108e-06f, -2.4084452e-06f, 2.3836194e-06f, -2.35898256e-06f,
+   2.33453375e-06f, -2.31027184e-06f, 2.28619592e-06f, -2.26230463e-06f,
+   2.23859752e-06f, -2.21507298e-06f, 2.19173057e-06f, -2.1685687e-06f,
+   2.1455869e-06f, -2.12278383e-06f, 2.10015855e-06f, -2.07771018e-06f,
+   2.05543756e-06f, -2.0333398e-06f, 2.01141597e-06f, -1.98966495e-06f,
+   1.96808583e-06f, -1.94667768e-06f, 1.92543962e-06f, -1.90437061e-06f,
+   1.88346951e-06f, -1.86273553e-06f, 1.84216776e-06f, -1.82176518e-06f,
+   1.80152676e-06f, -1.78145172e-06f, 1.7615389e-06f, -1.74178763e-06f,
+   1.72219688e-06f, -1.70276564e-06f, 1.683493e-06f, -1.66437815e-06f,
+   1.64542007e-06f, -1.62661786e-06f, 1.6079706e-06f, -1.58947751e-06f,
+   1.57113755e-06f, -1.55294981e-06f, 1.53491339e-06f, -1.5170275e-06f,
+   1.49929122e-06f, -1.48170352e-06f, 1.46426373e-06f, -1.44697083e-06f,
+   1.42982401e-06f, -1.41282226e-06f, 1.395965e-06f, -1.3792511e-06f,
+   1.36267977e-06f, -1.34625009e-06f, 1.32996138e-06f, -1.31381262e-06f,
+   1.29780312e-06f, -1.28193187e-06f, 1.26619807e-06f, -1.25060103e-06f,
+   1.23513962e-06f, -1.21981327e-06f, 1.20462107e-06f, -1.18956223e-06f,
+   1.17463583e-06f, -1.15984108e-06f, 1.14517729e-06f, -1.13064345e-06f,
+   1.11623888e-06f, -1.10196277e-06f, 1.08781421e-06f, -1.07379253e-06f,
+   1.05989693e-06f, -1.0461265e-06f, 1.03248055e-06f, -1.0189583e-06f,
+   1.00555894e-06f, -9.92281684e-07f, 9.79125844e-07f, -9.66090397e-07f,
+   9.5317489e-07f, -9.403783e-07f, 9.27700057e-07f, -9.15139253e-07f,
+   9.02695206e-07f, -8.90367176e-07f, 8.78154367e-07f, -8.66056098e-07f,
+   8.54071516e-07f, -8.42199995e-07f, 8.3044074e-07f, -8.18793012e-07f,
+   8.07256129e-07f, -7.95829294e-07f, 7.84511826e-07f, -7.73302986e-07f,
+   7.62202035e-07f, -7.5120829e-07f, 7.4032107e-07f, -7.29539636e-07f,
+   7.18863248e-07f, -7.08291225e-07f, 6.97822884e-07f, -6.87457543e-07f,
+   6.77194464e-07f, -6.67032964e-07f, 6.56972361e-07f, -6.4701203e-07f,
+   6.37151174e-07f, -6.2738917e-07f, 6.17725391e-07f, -6.08159098e-07f,
+   5.98689667e-07f, -5.89316357e-07f, 5.80038602e-07f, -5.70855718e-07f,
+   5.61766967e-07f, -5.5277178e-07f, 5.43869533e-07f, -5.35059428e-07f,
+   5.26341012e-07f, -5.17713488e-07f, 5.09176289e-07f, -5.00728731e-07f,
+   4.92370248e-07f, -4.84100212e-07f, 4.75917886e-07f, -4.67822758e-07f,
+   4.59814146e-07f, -4.51891481e-07f, 4.44054081e-07f, -4.36301377e-07f,
+   4.28632774e-07f, -4.21047616e-07f, 4.13545308e-07f, -4.06125281e-07f,
+   3.98786909e-07f, -3.91529625e-07f, 3.84352774e-07f, -3.77255844e-07f,
+   3.70238183e-07f, -3.6329925e-07f, 3.5643842e-07f, -3.49655153e-07f,
+   3.42948852e-07f, -3.36318976e-07f, 3.29764902e-07f, -3.23286088e-07f,
+   3.16881966e-07f, -3.10551968e-07f, 3.04295554e-07f, -2.98112127e-07f,
+   2.92001204e-07f, -2.85962159e-07f, 2.79994481e-07f, -2.74097602e-07f,
+   2.68270981e-07f, -2.62514106e-07f, 2.56826439e-07f, -2.5120741e-07f,
+   2.4565648e-07f, -2.40173165e-07f, 2.34756897e-07f, -2.29407178e-07f,
+   2.24123468e-07f, -2.18905257e-07f, 2.13752031e-07f, -2.08663266e-07f,
+   2.0363845e-07f, -1.98677085e-07f, 1.93778646e-07f, -1.8894265e-07f
+};
+
+alignas(64) constexpr int32_t KEISER_W3200_A9_Q28[1600] =
+{
+   170891248, -56963561, 34177910, -24412551,
+   18987288, -15534797, 13144567, -11391694,
+   10051229, -8992937, 8136197, -7428431,
+   6833885, -6327399, 5890754, -5510432,
+   5176192, -4880135, 4616069, -4379072,
+   4165183, -3971177, 3794404, -3632664,
+   3484115, -3347206, 3220619, -3103228,
+   2994065, -2892294, 2797187, -2708109,
+   2624505, -2545883, 2471811, -2401904,
+   2335820, -2273253, 2213929, -2157602,
+   2104049, -2053070, 2004484, -1958125,
+   1913843, -1871502, 1830976, -1792150,
+   1754920, -1719188, 1684865, -1651870,
+   1620127, -1589565, 1560120, -1531731,
+   1504341, -1477900, 1452358, -1427669,
+   1403792, -1380688, 1358318, -1336648,
+   1315646, -1295281, 1275524, -1256348,
+   1237729, -1219641, 1202062, -1184971,
+   1168348, -1152173, 1136429, -1121099,
+   1106165, -1091613, 1077429, -1063598,
+   1050107, -1036944, 1024097, -1011554,
+   999304, -987338, 975646, -964218,
+   953045, -942118, 931430, -920973,
+   910738, -900720, 890911, -881304,
+   871894, -862674, 853639, -844782,
+   836099, -827584, 819233, -811041,
+   803002, -795114, 787371, -779770,
+   772307, -764977, 757777, -750705,
+   743755, -736926, 730214, -723616,
+   717128, -710749, 704475, -698304,
+   692233, -686260, 680383, -674598,
+   668904, -663299, 657780, -652346,
+   646995, -641724, 636531, -631416,
+   626376, -621410, 616515, -611691,
+   606935, -602247, 597625, -593067,
+   588572, -584139, 579766, -575452,
+   571197, -566998, 562854, -558765,
+   554729, -550746, 546814, -542932,
+   539099, -535315, 531578, -527887,
+   524242, -520642, 517085, -513572,
+   510101, -506671, 503281, -499932,
+   496622, -493350, 490117, -486920,
+   483760, -480635, 477546, -474491,
+   471471, -468484, 465529, -462607,
+   459717, -456857, 454029, -451230,
+   448462, -445722, 443011, -440328,
+   437674, -435046, 432445, -429871,
+   427323, -424800, 422303, -419830,
+   417382, -414958, 412558, -410181,
+   407827, -405496, 403187, -400899,
+   398634, -396390, 394167, -391964,
+   389782, -387621, 385478, -383356,
+   381253, -379168, 377103, -375055,
+   373026, -371015, 369022, -367046,
+   365087, -363145, 361220, -359312,
+   357420, -355544, 353683, -351839,
+   350009, -348195, 346396, -344612,
+   342843, -341088, 339347, -337620,
+   335908, -334209, 332523, -330851,
+   329192, -327546, 325913, -324293,
+   322686, -321090, 319508, -317937,
+   316378, -314831, 313296, -311772,
+   310260, -308759, 307269, -305790,
+   304322, -302865, 301418, -299982,
+   298556, -297141, 295735, -294340,
+   292955, -291579, 290214, -288857,
+   287511, -286173, 284845, -283526,
+   282217, -280916, 279624, -278341,
+   277066, -275801, 274543, -273294,
+   272054, -270821, 269597, -268381,
+   267173, -265973, 264780, -263595,
+   262418, -261249, 260087, -258932,
+   257785, -256645, 255513, -254387,
+   253269, -252157, 251052, -249955,
+   248864, -247779, 246702, -245631,
+   244566, -243508, 242457, -241411,
+   240372, -239340, 238313, -237292,
+   236278, -235269, 234267, -233270,
+   232279, -231294, 230315, -229341,
+   228373, -227411, 226453, -225502,
+   224556, -223615, 222679, -221749,
+   220824, -219904, 218990, -218080,
+   217176, -216276, 215381, -214492,
+   213607, -212727, 211852, -210981,
+   210115, -209254, 208398, -207546,
+   206698, -205856, 205017, -204183,
+   203354, -202528, 201708, -200891,
+   200079, -199271, 198467, -197667,
+   196871, -196080, 195292, -194509,
+   193729, -192954, 192182, -191414,
+   190650, -189890, 189134, -188382,
+   187633, -186888, 186147, -185409,
+   184675, -183944, 183218, -182494,
+   181775, -181058, 180345, -179636,
+   178930, -178228, 177528, -176833,
+   176140, -175451, 174765, -174082,
+   173403, -172726, 172053, -171383,
+   170716, -170053, 169392, -168734,
+   168080, -167428, 166780, -166134,
+   165492, -164852, 164215, -163582,
+   162951, -162322, 161697, -161075,
+   160455, -159838, 159224, -158613,
+   158004, -157398, 156795, -156195,
+   155597, -155001, 154409, -153819,
+   153231, -152646, 152064, -151484,
+   150907, -150332, 149760, -149190,
+   148622, -148057, 147495, -146935,
+   146377, -145822, 145269, -144718,
+   144170, -143623, 143080, -142538,
+   141999, -141462, 140928, -140395,
+   139865, -139337, 138811, -138288,
+   137766, -137247, 136730, -136215,
+   135702, -135191, 134682, -134175,
+   133671, -133168, 132668, -132169,
+   131673, -131178, 130686, -130196,
+   129707, -129220, 128736, -128253,
+   127772, -127294, 126817, -126342,
+   125869, -125397, 124928, -124460,
+   123995, -123531, 123069, -122609,
+   122150, -121693, 121239, -120785,
+   120334, -119885, 119437, -118991,
+   118546, -118104, 117663, -117223,
+   116786, -116350, 115916, -115483,
+   115052, -114623, 114195, -113769,
+   113345, -112922, 112501, -112081,
+   111663, -111247, 110832, -110419,
+   110007, -109597, 109188, -108781,
+   108375, -107971, 107569, -107168,
+   106768, -106370, 105973, -105578,
+   105185, -104792, 104402, -104012,
+   103624, -103238, 102853, -102469,
+   102087, -101706, 101327, -100949,
+   100572, -100197, 99823, -99450,
+   99079, -98709, 98341, -97973,
+   97608, -97243, 96880, -96518,
+   96157, -95798, 95440, -95083,
+   94728, -94374, 94021, -93669,
+   93319, -92970, 92622, -92275,
+   91930, -91586, 91243, -90901,
+   90561, -90221, 89883, -89546,
+   89211, -88876, 88543, -88211,
+   87880, -87550, 87221, -86894,
+   86567, -86242, 85918, -85595,
+   85273, -84953, 84633, -84315,
+   83998, -83681, 83366, -83052,
+   82739, -82428, 82117, -81807,
+   81499, -81191, 80885, -80580,
+   80275, -79972, 79670, -79369,
+   79069, -78770, 78472, -78175,
+   77879, -77584, 77290, -76997,
+   76705, -76414, 76124, -75835,
+   75548, -75261, 74975, -74690,
+   74406, -74123, 73841, -73560,
+   73280, -73001, 72722, -72445,
+   72169, -71894, 71619, -71346,
+   71073, -70802, 70531, -70261,
+   69992, -69725, 69458, -69192,
+   68926, -68662, 68399, -68136,
+   67875, -67614, 67354, -67095,
+   66837, -66580, 66324, -66068,
+   65814, -65560, 65307, -65055,
+   64804, -64554, 64305, -64056,
+   63808, -63561, 63315, -63070,
+   62826, -62582, 62339, -62097,
+   61856, -61616, 61377, -61138,
+   60900, -60663, 60427, -60191,
+   59957, -59723, 59490, -59257,
+   59026, -58795, 58565, -58336,
+   58108, -57880, 57653, -57427,
+   57202, -56977, 56753, -56530,
+   56308, -56086, 55865, -55645,
+   55426, -55207, 54990, -54773,
+   54556, -54340, 54126, -53911,
+   53698, -53485, 53273, -53062,
+   52851, -52641, 52432, -52224,
+   52016, -51809, 51602, -51397,
+   51192, -50987, 50784, -50581,
+   50379, -50177, 49976, -49776,
+   49576, -49378, 49179, -48982,
+   48785, -48589, 48393, -48199,
+   48004, -47811, 47618, -47426,
+   47234, -47043, 46853, -46663,
+   46474, -46286, 46098, -45911,
+   45725, -45539, 45354, -45169,
+   44985, -44802, 44619, -44437,
+   44256, -44075, 43895, -43715,
+   43536, -43358, 43180, -43003,
+   42827, -42651, 42475, -42301,
+   42126, -41953, 41780, -41607,
+   41436, -41264, 41094, -40924,
+   40754, -40585, 40417, -40249,
+   40082, -39916, 39750, -39584,
+   39419, -39255, 39091, -38928,
+   38766, -38604, 38442, -38281,
+   38121, -37961, 37802, -37643,
+   37485, -37327, 37170, -37013,
+   36857, -36702, 36547, -36392,
+   36239, -36085, 35932, -35780,
+   35628, -35477, 35326, -35176,
+   35027, -34878, 34729, -34581,
+   34433, -34286, 34140, -33993,
+   33848, -33703, 33558, -33414,
+   33271, -33128, 32985, -32843,
+   32702, -32561, 32420, -32280,
+   32141, -32002, 31863, -31725,
+   31587, -31450, 31314, -31177,
+   31042, -30906, 30772, -30638,
+   30504, -30370, 30238, -30105,
+   29973, -29842, 29711, -29581,
+   29450, -29321, 29192, -29063,
+   28935, -28807, 28680, -28553,
+   28427, -28301, 28175, -28050,
+   27926, -27802, 27678, -27555,
+   27432, -27310, 27188, -27066,
+   26945, -26825, 26704, -26585,
+   26465, -26346, 26228, -26110,
+   25992, -25875, 25759, -25642,
+   25526, -25411, 25296, -25181,
+   25067, -24953, 24840, -24727,
+   24614, -24502, 24390, -24279,
+   24168, -24057, 23947, -23838,
+   23728, -23619, 23511, -23403,
+   23295, -23188, 23081, -22974,
+   22868, -22762, 22657, -22552,
+   22448, -22343, 22240, -22136,
+   22033, -21930, 21828, -21726,
+   21625, -21524, 21423, -21323,
+   21223, -21123, 21024, -20925,
+   20826, -20728, 20630, -20533,
+   20436, -20339, 20243, -20147,
+   20051, -19956, 19861, -19767,
+   19673, -19579, 19485, -19392,
+   19300, -19207, 19115, -19024,
+   18932, -18841, 18751, -18660,
+   18571, -18481, 18392, -18303,
+   18214, -18126, 18038, -17951,
+   17863, -17777, 17690, -17604,
+   17518, -17433, 17347, -17262,
+   17178, -17094, 17010, -16926,
+   16843, -16760, 16678, -16595,
+   16513, -16432, 16350, -16270,
+   16189, -16109, 16029, -15949,
+   15869, -15790, 15712, -15633,
+   15555, -15477, 15400, -15322,
+   15245, -15169, 15093, -15017,
+   14941, -14865, 14790, -14716,
+   14641, -14567, 14493, -14419,
+   14346, -14273, 14200, -14128,
+   14056, -13984, 13912, -13841,
+   13770, -13700, 13629, -13559,
+   13489, -13420, 13350, -13281,
+   13213, -13144, 13076, -13008,
+   12941, -12874, 12807, -12740,
+   12673, -12607, 12541, -12476,
+   12410, -12345, 12280, -12216,
+   12151, -12087, 12024, -11960,
+   11897, -11834, 11771, -11709,
+   11647, -11585, 11523, -11462,
+   11400, -11339, 11279, -11218,
+   11158, -11098, 11039, -10980,
+   10920, -10862, 10803, -10745,
+   10686, -10629, 10571, -10514,
+   10456, -10400, 10343, -10287,
+   10230, -10175, 10119, -10063,
+   10008, -9953, 9899, -9844,
+   9790, -9736, 9682, -9629,
+   9575, -9522, 9469, -9417,
+   9364, -9312, 9260, -9209,
+   9157, -9106, 9055, -9004,
+   8953, -8903, 8853, -8803,
+   8753, -8704, 8655, -8606,
+   8557, -8508, 8460, -8412,
+   8364, -8316, 8269, -8221,
+   8174, -8128, 8081, -8034,
+   7988, -7942, 7896, -7851,
+   7805, -7760, 7715, -7670,
+   7626, -7581, 7537, -7493,
+   7450, -7406, 7363, -7319,
+   7276, -7234, 7191, -7149,
+   7107, -7065, 7023, -6981,
+   6940, -6899, 6858, -6817,
+   6776, -6736, 6695, -6655,
+   6615, -6576, 6536, -6497,
+   6458, -6419, 6380, -6342,
+   6303, -6265, 6227, -6189,
+   6151, -6114, 6077, -6039,
+   6002, -5966, 5929, -5893,
+   5856, -5820, 5784, -5749,
+   5713, -5678, 5643, -5608,
+   5573, -5538, 5503, -5469,
+   5435, -5401, 5367, -5333,
+   5300, -5266, 5233, -5200,
+   5167, -5135, 5102, -5070,
+   5037, -5005, 4973, -4942,
+   4910, -4879, 4847, -4816,
+   4785, -4755, 4724, -4693,
+   4663, -4633, 4603, -4573,
+   4543, -4514, 4484, -4455,
+   4426, -4397, 4368, -4339,
+   4311, -4282, 4254, -4226,
+   4198, -4170, 4143, -4115,
+   4088, -4061, 4033, -4006,
+   3980, -3953, 3926, -3900,
+   3874, -3848, 3822, -3796,
+   3770, -3745, 3719, -3694,
+   3669, -3644, 3619, -3594,
+   3569, -3545, 3520, -3496,
+   3472, -3448, 3424, -3401,
+   3377, -3353, 3330, -3307,
+   3284, -3261, 3238, -3215,
+   3193, -3170, 3148, -3126,
+   3104, -3082, 3060, -3038,
+   3016, -2995, 2973, -2952,
+   2931, -2910, 2889, -2868,
+   2848, -2827, 2807, -2786,
+   2766, -2746, 2726, -2706,
+   2686, -2667, 2647, -2628,
+   2608, -2589, 2570, -2551,
+   2532, -2513, 2495, -2476,
+   2458, -2439, 2421, -2403,
+   2385, -2367, 2349, -2332,
+   2314, -2296, 2279, -2262,
+   2245, -2227, 2210, -2194,
+   2177, -2160, 2143, -2127,
+   2111, -2094, 2078, -2062,
+   2046, -2030, 2014, -1998,
+   1983, -1967, 1952, -1936,
+   1921, -1906, 1891, -1876,
+   1861, -1846, 1831, -1817,
+   1802, -1788, 1774, -1759,
+   1745, -1731, 1717, -1703,
+   1689, -1676, 1662, -1648,
+   1635, -1621, 1608, -1595,
+   1582, -1569, 1556, -1543,
+   1530, -1517, 1505, -1492,
+   1479, -1467, 1455, -1442,
+   1430, -1418, 1406, -1394,
+   1382, -1371, 1359, -1347,
+   1336, -1324, 1313, -1301,
+   1290, -1279, 1268, -1257,
+   1246, -1235, 1224, -1213,
+   1203, -1192, 1182, -1171,
+   1161, -1150, 1140, -1130,
+   1120, -1110, 1100, -1090,
+   1080, -1070, 1060, -1051,
+   1041, -1032, 1022, -1013,
+   1004, -994, 985, -976,
+   967, -958, 949, -940,
+   931, -923, 914, -905,
+   897, -888, 880, -871,
+   863, -855, 847, -839,
+   830, -822, 814, -807,
+   799, -791, 783, -775,
+   768, -760, 753, -745,
+   738, -731, 723, -716,
+   709, -702, 695, -688,
+   681, -674, 667, -660,
+   653, -647, 640, -633,
+   627, -620, 614, -607,
+   601, -595, 588, -582,
+   576, -570, 564, -558,
+   552, -546, 540, -534,
+   528, -523, 517, -511,
+   506, -500, 495, -489,
+   484, -478, 473, -468,
+   462, -457, 452, -447,
+   442, -437, 432, -427,
+   422, -417, 412, -407,
+   402, -398, 393, -388,
+   384, -379, 375, -370,
+   366, -361, 357, -353,
+   348, -344, 340, -336,
+   332, -327, 323, -319,
+   315, -311, 307, -304,
+   300, -296, 292, -288,
+   285, -281, 277, -274,
+   270, -266, 263, -259,
+   256, -252, 249, -246,
+   242, -239, 236, -232,
+   229, -226, 223, -220,
+   217, -214, 211, -208,
+   205, -202, 199, -196,
+   193, -190, 187, -185,
+   182, -179, 176, -174,
+   171, -168, 166, -163,
+   161, -158, 156, -153,
+   151, -148, 146, -144,
+   141, -139, 137, -134,
+   132, -130, 128, -126,
+   123, -121, 119, -117,
+   115, -113, 111, -109,
+   107, -105, 103, -101,
+   99, -98, 96, -94,
+   92, -90, 89, -87,
+   85, -83, 82, -80,
+   78, -77, 75, -74,
+   72, -70, 69, -67,
+   66, -64, 63, -62,
+   60, -59, 57, -56,
+   55, -53, 52, -51
+};
+
+struct SPresetFilterTable
+{
+   size_t table_width;
+   double alpha;
+   const double * f64;
+   const float * f32;
+   const int32_t * fixed;
+};
+
+constexpr SPresetFilterTable PRESET_FILTER_TABLES[] =
+{
+   { 3200, 9, KEISER_W3200_A9_F64, KEISER_W3200_A9_F32, KEISER_W3200_A9_Q28 },
+};
@@ -0,0 +1,162 @@
+/*
+Mapped File
+
+Maps a whole file into memory on Windows and POSIX systems.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Mapped file
+A read-only mapping is shared: every process that maps the same file uses
+the same physical pages of the page cache. A copy-on-write mapping shares
+them as well until a page is written to, which then gets a private copy, so
+its contents may be used as a writable buffer without changing the file.
+*/
+
+class CMappedFile
+{
+public:
+   enum class Access { ReadOnly, CopyOnWrite };
+
+   CMappedFile(const char * path, Access access)
+   {
+      if (path && !map(path, access))
+         unmap();
+   }
+
+   ~CMappedFile()
+   {
+      unmap();
+   }
+
+   CMappedFile(const CMappedFile&) = delete;
+   CMappedFile& operator=(const CMappedFile&) = delete;
+
+   bool IsMapped() const
+   {
+      return m_base != nullptr;
+   }
+
+   //writing through the pointer is only allowed for copy-on-write mappings
+   uint8_t * Data() const
+   {
+      return m_base;
+   }
+
+   uint64_t Size() const
+   {
+      return m_size;
+   }
+
+   //tells the operating system that the range will be read sequentially and should be read ahead
+   void Prefetch(const uint8_t * data, uint64_t size) const
+   {
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+      WIN32_MEMORY_RANGE_ENTRY range{ const_cast<uint8_t *>(data), static_cast<SIZE_T>(size) };
+      PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+      (void)data;
+      (void)size;
+#endif
+#else
+      //advice works on whole pages
+      uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+      uintptr_t first = reinterpret_cast<uintptr_t>(data) / page * page;
+      size_t length = static_cast<size_t>(reinterpret_cast<uintptr_t>(data) + size - first);
+      madvise(reinterpret_cast<void *>(first), length, MADV_SEQUENTIAL);
+      madvise(reinterpret_cast<void *>(first), length, MADV_WILLNEED);
+#endif
+   }
+
+private:
+
+   uint8_t * m_base = nullptr;
+   uint64_t m_size = 0;
+#ifdef _WIN32
+   HANDLE m_file = INVALID_HANDLE_VALUE;
+   HANDLE m_mapping = nullptr;
+#endif
+
+   bool map(const char * path, Access access)
+   {
+      const bool copy = access == Access::CopyOnWrite;
+#ifdef _WIN32
+      m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+      if (m_file == INVALID_HANDLE_VALUE)
+         return false;
+      LARGE_INTEGER size;
+      if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+         return false;
+      m_mapping = CreateFileMappingA(m_file, nullptr, copy ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+      if (!m_mapping)
+         return false;
+      void * base = MapViewOfFile(m_mapping, copy ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+      if (!base)
+         return false;
+      m_base = static_cast<uint8_t *>(base);
+      m_size = static_cast<uint64_t>(size.QuadPart);
+#else
+      int fd = open(path, O_RDONLY);
+      if (fd < 0)
+         return false;
+      struct stat status;
+      void * base = MAP_FAILED;
+      if (fstat(fd, &status) == 0 && status.st_size > 0)
+         base = mmap(nullptr, static_cast<size_t>(status.st_size), copy ? PROT_READ | PROT_WRITE : PROT_READ, copy ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+      close(fd);   //the mapping keeps the file open
+      if (base == MAP_FAILED)
+         return false;
+      m_base = static_cast<uint8_t *>(base);
+      m_size = static_cast<uint64_t>(status.st_size);
+#endif
+      return true;
+   }
+
+   void unmap()
+   {
+#ifdef _WIN32
+      if (m_base)
+         UnmapViewOfFile(m_base);
+      if (m_mapping)
+         CloseHandle(m_mapping);
+      if (m_file != INVALID_HANDLE_VALUE)
+         CloseHandle(m_file);
+      m_mapping = nullptr;
+      m_file = INVALID_HANDLE_VALUE;
+#else
+      if (m_base)
+         munmap(m_base, static_cast<size_t>(m_size));
+#endif
+      m_base = nullptr;
+      m_size = 0;
+   }
+};
@@ -0,0 +1,149 @@
+/*
+Mapped Wave File
+
+Gives direct access to the samples of an uncompressed wave file mapped into
+memory, so that they don't have to be read into a separate buffer.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "MappedFile.h"
+#include <cstring>
+#include <type_traits>
+
+/* Mapped wave file
+The class maps a RIFF WAVE file copy-on-write and parses its fmt and data
+chunks. If the samples are stored the way an interleaved SRDoubler frame
+holds them - little endian 16 or 32 bit integers or 32 or 64 bit floats,
+naturally aligned and not packed into narrower containers - Samples() returns
+a pointer to them in the mapping. Pages are only read from the file when
+they are touched and are shared with the page cache; the operating system is
+told that the data will be read sequentially and should be prefetched.
+
+Any other file, including big endian AIFF and packed 24 bit PCM, yields a null
+pointer, and the caller should read it with libsndfile instead.
+*/
+
+class CMappedWaveFile
+{
+public:
+   explicit CMappedWaveFile(const char * path) : m_file{ path, CMappedFile::Access::CopyOnWrite }
+   {
+      if (m_file.IsMapped())
+         parse();
+   }
+
+   //true if the file is a wave file with samples the class can expose
+   bool IsMapped() const
+   {
+      return m_data != nullptr;
+   }
+
+   unsigned Channels() const
+   {
+      return m_channels;
+   }
+
+   uint64_t Frames() const
+   {
+      return m_frames;
+   }
+
+   //returns the interleaved samples if they are stored as SampleFormat, otherwise nullptr
+   template<typename SampleFormat> SampleFormat * Samples() const
+   {
+      static_assert(std::is_arithmetic<SampleFormat>::value, "Samples are numbers");
+
+      if (!m_data || m_float != std::is_floating_point<SampleFormat>::value || m_sample_bytes != sizeof(SampleFormat))
+         return nullptr;
+      if (reinterpret_cast<uintptr_t>(m_data) % alignof(SampleFormat) != 0)
+         return nullptr;
+      return reinterpret_cast<SampleFormat *>(m_data);
+   }
+
+private:
+
+   static const uint16_t WAVE_FORMAT_PCM = 1;
+   static const uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+   static const uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+   CMappedFile m_file;
+   uint8_t * m_data = nullptr;   //the first sample, if the file is usable
+   unsigned m_channels = 0;
+   uint64_t m_frames = 0;
+   bool m_float = false;
+   size_t m_sample_bytes = 0;
+
+   static uint16_t read16(const uint8_t * p)
+   {
+      return static_cast<uint16_t>(p[0] | (p[1] << 8));
+   }
+
+   static uint32_t read32(const uint8_t * p)
+   {
+      return uint32_t(read16(p)) | (uint32_t(read16(p + 2)) << 16);
+   }
+
+   //finds the fmt and data chunks and accepts the file if its samples can be used in place
+   void parse()
+   {
+      uint8_t * const base = m_file.Data();
+      const uint64_t file_size = m_file.Size();
+      if (file_size < 12 || memcmp(base, "RIFF", 4) || memcmp(base + 8, "WAVE", 4))
+         return;
+
+      uint16_t format = 0, block_align = 0, bits = 0;
+      for (uint64_t chunk = 12; chunk + 8 <= file_size;)
+      {
+         uint8_t * header = base + chunk;
+         uint64_t size = read32(header + 4);
+         uint8_t * body = header + 8;
+         uint64_t available = file_size - chunk - 8;
+
+         if (!memcmp(header, "fmt ", 4) && size >= 16 && size <= available)
+         {
+            format = read16(body);
+            m_channels = read16(body + 2);
+            block_align = read16(body + 12);
+            bits = read16(body + 14);
+            //the extensible format keeps the actual one in the first two bytes of its subformat GUID
+            if (format == WAVE_FORMAT_EXTENSIBLE && size >= 26)
+               format = read16(body + 24);
+         }
+         else if (!memcmp(header, "data", 4))
+         {
+            //a writer that was interrupted may leave the size unset, in which case the data runs to the end of the file
+            if (size > available)
+               size = available;
+            if ((format != WAVE_FORMAT_PCM && format != WAVE_FORMAT_IEEE_FLOAT) || m_channels == 0)
+               return;
+            if (bits % 8 != 0 || block_align != m_channels * (bits / 8))
+               return;
+
+            m_float = format == WAVE_FORMAT_IEEE_FLOAT;
+            m_sample_bytes = bits / 8;
+            m_frames = size / block_align;
+            m_data = body;
+            m_file.Prefetch(body, size);
+            return;
+         }
+
+         //chunks are padded to an even size
+         chunk += 8 + size + (size & 1);
+      }
+   }
+};
+
@@ -0,0 +1,222 @@
+/*
+Minimum Phase Doubler
+
+Doubles the sampling rate with the minimum phase version of the Keiser window
+filter, which needs no input frames after the one it interpolates, for live
+monitoring and other uses where the delay matters more than the phase.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "FastFilterDesign.h"
+#include "FFT.h"
+
+/* Minimum phase design
+SRDoubler filters the zero stuffed input with a linear phase filter of
+2*table_width-1 taps at the output rate: the center tap is 1 and the taps
+2*dist+1 away from it are the coefficients of CHalfFilter. It is symmetric,
+so every output frame waits for the halfWidth input frames after it.
+
+The minimum phase filter with the same magnitude response is obtained with
+the real cepstrum: the log magnitude of the spectrum is transformed back,
+the anticausal part of the cepstrum is folded onto the causal one, and the
+exponent of its spectrum is transformed back again. The transforms are
+MINIMUM_PHASE_OVERSAMPLING times longer than the filter, which keeps the
+aliasing of the cepstrum negligible, and the log magnitude is floored
+MINIMUM_PHASE_FLOOR below the peak so that the zeros of the stopband stay
+finite. The result is causal, with its energy at its start, and is cut to
+the length of the linear phase filter.
+
+The filter isn't a half band one any more, so the input frames aren't passed
+through: both output frames of an input frame are calculated, each with its
+own phase of the filter. The table_width taps of either phase are stored
+from the oldest input frame to the newest one, first those of the even
+output frames and then those of the odd ones, 2*table_width coefficients in
+all.
+*/
+
+const size_t MINIMUM_PHASE_OVERSAMPLING = 64;
+const double MINIMUM_PHASE_FLOOR = 1E-12;   //-240db
+
+template<typename CoefficientFormat>
+inline void MinimumPhaseKeiserTables(double alpha, size_t table_width, CoefficientFormat * out)
+{
+   using Complex = CFFT::Complex;
+
+   //the linear phase filter at the output rate, centered at table_width-1
+   const size_t halfWidth = table_width / 2, taps = 2 * table_width - 1;
+   std::vector<double> half(halfWidth);
+   FastKeiserHalfTable(alpha, halfWidth, half.data());
+
+   const CFFT fft{ CFFT::RoundUp(MINIMUM_PHASE_OVERSAMPLING * taps) };
+   const size_t size = fft.Size();
+   std::vector<Complex> spectrum(size);
+   spectrum[table_width - 1] = 1;
+   for (size_t dist = 0; dist < halfWidth; dist++)
+      spectrum[table_width - 1 - (2 * dist + 1)] = spectrum[table_width - 1 + (2 * dist + 1)] = half[dist];
+   fft.Forward(spectrum.data());
+
+   //the real cepstrum
+   double peak = 0;
+   for (const Complex& bin : spectrum)
+      peak = std::max(peak, std::abs(bin));
+   for (Complex& bin : spectrum)
+      bin = std::log(std::max(std::abs(bin), peak * MINIMUM_PHASE_FLOOR));
+   fft.Inverse(spectrum.data());
+
+   //fold the anticausal part onto the causal one
+   for (size_t n = 0; n < size; n++)
+   {
+      double value = spectrum[n].real() / size;
+      spectrum[n] = (n == 0 || n == size / 2) ? value : (n < size / 2) ? 2 * value : 0.;
+   }
+   fft.Forward(spectrum.data());
+   for (Complex& bin : spectrum)
+      bin = std::exp(bin);
+   fft.Inverse(spectrum.data());
+
+   //tap 2*k+phase at the output rate is applied to input frame n-k for output frame 2*n+phase
+   for (size_t phase = 0; phase < 2; phase++)
+   {
+      for (size_t k = 0; k < table_width; k++)
+      {
+         size_t tap = 2 * k + phase;
+         double value = (tap < taps) ? spectrum[tap].real() / size : 0.;
+         out[phase * table_width + (table_width - 1 - k)] = QuantizeCoefficient<CoefficientFormat>(value);
+      }
+   }
+}
+
+//the delay of the filter at low frequencies in output frames: the centroid of its taps
+template<typename CoefficientFormat>
+inline double MinimumPhaseDelay(const CoefficientFormat * tables, size_t table_width)
+{
+   double moment = 0, sum = 0;
+   for (size_t phase = 0; phase < 2; phase++)
+   {
+      for (size_t k = 0; k < table_width; k++)
+      {
+         double tap = CoefficientValue(tables[phase * table_width + (table_width - 1 - k)]);
+         moment += double(2 * k + phase) * tap;
+         sum += tap;
+      }
+   }
+   return moment / sum;
+}
+
+/* Minimum phase doubler
+Upsamples a stream that arrives in blocks with the tables of
+MinimumPhaseKeiserTables(). Both output frames of an input frame are written
+as soon as it arrives, so Process() returns 2*count frames without any
+leading silence and there is nothing to flush; the output of Run() for a
+whole buffer is the same as that of Process() for any blocking of it. The
+class keeps the last table_width-1 input frames as history in a linear
+buffer, like CStreamingDoubler.
+*/
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class CMinimumPhaseDoubler
+{
+public:
+   using Doubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename Doubler::SampleFrame;
+   using FrameSpan = typename Doubler::FrameSpan;
+   using FrameVector = typename Doubler::FrameVector;
+   using CoefficientFormat = typename Doubler::CoefficientFormat;
+   using size_type = typename Doubler::size_type;
+
+   //tables points to the 2*table_width coefficients of MinimumPhaseKeiserTables()
+   CMinimumPhaseDoubler(const CoefficientFormat * tables) : m_tables{ tables }
+   {
+      Reset();
+   }
+
+   //input frames an output frame waits for after the input frame it is interpolated at
+   static constexpr size_type Latency()
+   {
+      return 0;
+   }
+
+   //forgets the history and starts a new stream
+   void Reset()
+   {
+      m_history.assign(table_width - 1, SampleFrame{});
+      m_start = 0;
+   }
+
+   //consumes count input frames and writes exactly 2*count frames to out
+   void Process(const SampleFrame * in, size_type count, SampleFrame * out)
+   {
+      m_history.insert(m_history.end(), in, in + count);
+      run(m_history.data() + m_start, count, out);
+      m_start += count;
+
+      if (m_start >= table_width)
+      {
+         m_history.erase(m_history.begin(), m_history.begin() + m_start);
+         m_start = 0;
+      }
+   }
+
+   FrameVector Process(const FrameSpan& in)
+   {
+      FrameVector output(2 * in.size());
+
+      Process(in.data(), in.size(), output.data());
+
+      return output;
+   }
+
+   //doubles a whole buffer, which starts after silence, without touching the history
+   FrameVector Run(const FrameSpan& in) const
+   {
+      FrameVector padded(table_width - 1 + in.size());
+      std::copy(in.begin(), in.end(), padded.begin() + (table_width - 1));
+      FrameVector output(2 * in.size());
+
+      run(padded.data(), in.size(), output.data());
+
+      return output;
+   }
+
+private:
+
+   const CoefficientFormat * m_tables;
+   FrameVector m_history;          //frames from m_start on are still needed
+   size_type m_start;
+   DotKernel<SampleFormat, CoefficientFormat, numChannels> m_kernel = SelectDotKernel<SampleFormat, CoefficientFormat, numChannels>();
+
+   SampleFrame dot(const SampleFrame * in, const CoefficientFormat * coefs) const
+   {
+      AccumulatorFormat<CoefficientFormat> sums[numChannels];
+      m_kernel(&in[0][0], coefs, table_width, sums);
+
+      SampleFrame frame;
+      for (size_t c = 0; c < numChannels; c++)
+         frame[c] = ToSample<SampleFormat>(sums[c]);
+      return frame;
+   }
+
+   //input frame i is the last one of the table_width frames starting at in[i]
+   void run(const SampleFrame * in, size_type count, SampleFrame * out) const
+   {
+      for (size_type i = 0; i < count; i++)
+      {
+         out[2 * i] = dot(in + i, m_tables);
+         out[2 * i + 1] = dot(in + i, m_tables + table_width);
+      }
+   }
+};
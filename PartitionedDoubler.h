@@ -0,0 +1,332 @@
+/*
+Partitioned Doubler
+
+A streaming doubler that convolves with the Keiser window filter by uniformly
+partitioned FFT convolution, optionally with a direct form head.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "FFT.h"
+
+/* Partitioned doubler
+A drop-in replacement for CStreamingDoubler for small blocks and long tables.
+As in CFFTDoubler, the interpolated frame following input frame i is output
+n = i+halfWidth of a causal FIR filter whose impulse response is the table.
+
+The table is cut into partitions of block_size taps, and the transform of every
+partition is computed once. Input blocks are transformed as they complete and
+kept in a frequency domain delay line, so each block costs one forward and one
+inverse transform of 2*block_size points plus one complex multiply-add per
+partition and bin.
+
+With a direct form head the first partition is convolved in the time domain
+sample by sample, and the other partitions only need blocks that are already
+complete. The latency is then halfWidth frames, the same as that of
+CStreamingDoubler. Without it the whole filter runs in the frequency domain
+and a block_size frame latency is added.
+
+Two channels share one complex transform, one as its real and the other as
+its imaginary part. The output matches CStreamingDoubler to within rounding.
+*/
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class CPartitionedDoubler
+{
+public:
+   using Doubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename Doubler::SampleFrame;
+   using FrameSpan = typename Doubler::FrameSpan;
+   using FrameVector = typename Doubler::FrameVector;
+   using CoefficientFormat = typename Doubler::CoefficientFormat;
+   using size_type = typename Doubler::size_type;
+   using Complex = CFFT::Complex;
+
+   //block_size should be a power of two
+   template<typename FilterType>
+   CPartitionedDoubler(const FilterType& filter, size_type block_size = 64, bool direct_head = true) :
+      m_doubler{ m_no_input, filter }, m_block_size{ block_size }, m_direct_head{ direct_head }, m_fft{ 2 * block_size }
+   {
+      prepareFilter(m_doubler.Coefficients());
+      Reset();
+   }
+
+   //input frames between the moment a frame enters and the moment it leaves the doubler
+   size_type Latency() const
+   {
+      return table_width / 2 + (m_direct_head ? 0 : m_block_size);
+   }
+
+   //forgets the history and starts a new stream
+   void Reset()
+   {
+      //two blocks of silence precede the stream so that the first transform needs no special case
+      m_history_first = -2 * static_cast<ptrdiff_t>(m_block_size);
+      m_history.assign(2 * m_block_size, SampleFrame{});
+      m_received = 0;
+      m_emitted = 0;
+      m_y_first = 0;
+      m_y.clear();
+      m_block_index = 0;
+      for (auto& delay_line : m_delay_lines)
+         for (auto& spectrum : delay_line)
+            std::fill(spectrum.begin(), spectrum.end(), Complex());
+      for (auto& tail : m_tails)
+         std::fill(tail.begin(), tail.end(), 0.);
+   }
+
+   //consumes count input frames and writes exactly 2*count frames to out
+   void Process(const SampleFrame * in, size_type count, SampleFrame * out)
+   {
+      //split the input at block boundaries
+      while (count > 0)
+      {
+         size_type fill = static_cast<size_type>(m_received % m_block_size);
+         size_type segment = std::min(count, m_block_size - fill);
+
+         m_history.insert(m_history.end(), in, in + segment);
+         if (m_direct_head)
+         {
+            for (size_type k = 0; k < segment; k++)
+               m_y.push_back(headFrame(m_received + k, fill + k));
+         }
+         m_received += segment;
+
+         if (fill + segment == m_block_size)
+            completeBlock();
+
+         in += segment;
+         count -= segment;
+         emit(segment, out);
+         out += 2 * segment;
+      }
+
+      discardUnneeded();
+   }
+
+   FrameVector Process(const FrameSpan& in)
+   {
+      FrameVector output(2 * in.size());
+
+      Process(in.data(), in.size(), output.data());
+
+      return output;
+   }
+
+   //writes the last 2*Latency() frames to out and resets the doubler
+   void Flush(SampleFrame * out)
+   {
+      FrameVector silence(Latency());
+
+      Process(silence.data(), silence.size(), out);
+      Reset();
+   }
+
+   FrameVector Flush()
+   {
+      FrameVector output(2 * Latency());
+
+      Flush(output.data());
+
+      return output;
+   }
+
+private:
+
+   using Spectrum = std::vector<Complex>;
+   static const size_t channelPairs = (numChannels + 1) / 2;
+
+   const FrameSpan m_no_input{};   //the doubler only supplies the coefficients
+   Doubler m_doubler;
+   const size_type m_block_size;
+   const bool m_direct_head;
+   CFFT m_fft;
+
+   std::vector<double> m_head;                  //the first block_size taps of the table
+   std::vector<Spectrum> m_partitions;          //transforms of the table partitions, scaled by 1/(2*block_size)
+   std::vector<std::vector<Spectrum>> m_delay_lines;   //per channel pair, indexed by block number modulo the partition count
+   std::vector<std::vector<double>> m_tails;    //per channel, the contribution of the later partitions to the current block
+
+   FrameVector m_history;          //input frames from m_history_first on
+   ptrdiff_t m_history_first;
+   FrameVector m_y;                //FIR outputs from m_y_first on
+   ptrdiff_t m_y_first;
+   ptrdiff_t m_received;
+   ptrdiff_t m_emitted;            //output frame pairs written so far
+   size_t m_block_index;           //number of completed blocks
+
+   void prepareFilter(const CoefficientFormat * coefficients)
+   {
+      if (m_block_size == 0 || (m_block_size & (m_block_size - 1)) != 0)
+         throw std::runtime_error("Block size should be a power of two");
+
+      //unfold the distance ordered coefficients into the full symmetric table
+      const size_t halfWidth = table_width / 2;
+      std::vector<double> table(table_width);
+      for (size_t dist = 0; dist < halfWidth; dist++)
+      {
+         table[halfWidth + dist] = CoefficientValue(coefficients[dist]);
+         table[halfWidth - 1 - dist] = CoefficientValue(coefficients[dist]);
+      }
+
+      m_head.assign(m_block_size, 0.);
+      std::copy(table.begin(), table.begin() + std::min(m_block_size, table_width), m_head.begin());
+
+      const size_t partitions = (table_width + m_block_size - 1) / m_block_size;
+      for (size_t p = 0; p < partitions; p++)
+      {
+         Spectrum spectrum(2 * m_block_size);
+         for (size_t k = 0; k < m_block_size && p * m_block_size + k < table_width; k++)
+            spectrum[k] = table[p * m_block_size + k] / (2. * m_block_size);
+         m_fft.Forward(spectrum.data());
+         m_partitions.push_back(std::move(spectrum));
+      }
+
+      m_delay_lines.assign(channelPairs, std::vector<Spectrum>(partitions, Spectrum(2 * m_block_size)));
+      m_tails.assign(numChannels, std::vector<double>(m_block_size));
+   }
+
+   const SampleFrame& inputFrame(ptrdiff_t n) const
+   {
+      return m_history[static_cast<size_type>(n - m_history_first)];
+   }
+
+   //FIR output n: the first partition convolved directly plus the precomputed tail
+   SampleFrame headFrame(ptrdiff_t n, size_type position) const
+   {
+      const SampleFrame * newest = &inputFrame(n);
+      double sums[numChannels];
+      for (size_t c = 0; c < numChannels; c++)
+         sums[c] = m_tails[c][position];
+      for (size_type k = 0; k < m_block_size; k++)
+      {
+         const SampleFrame& frame = *(newest - k);
+         for (size_t c = 0; c < numChannels; c++)
+            sums[c] += m_head[k] * double(frame[c]);
+      }
+
+      SampleFrame frame;
+      for (size_t c = 0; c < numChannels; c++)
+         frame[c] = ToSample<SampleFormat>(sums[c]);
+      return frame;
+   }
+
+   //transforms the block just completed and calculates the FIR outputs it makes available
+   void completeBlock()
+   {
+      const ptrdiff_t block_start = m_received - static_cast<ptrdiff_t>(m_block_size);
+      const size_t partitions = m_partitions.size();
+      const size_t size = 2 * m_block_size;
+      Spectrum accumulator(size);
+
+      for (size_t pair = 0; pair < channelPairs; pair++)
+      {
+         const size_t c0 = 2 * pair, c1 = c0 + 1;
+
+         //the previous and the current block
+         Spectrum& spectrum = m_delay_lines[pair][m_block_index % partitions];
+         for (size_t m = 0; m < size; m++)
+         {
+            const SampleFrame& frame = inputFrame(block_start - static_cast<ptrdiff_t>(m_block_size) + static_cast<ptrdiff_t>(m));
+            spectrum[m] = Complex(double(frame[c0]), (c1 < numChannels) ? double(frame[c1]) : 0.);
+         }
+         m_fft.Forward(spectrum.data());
+
+         //with a direct form head, the partitions from the second on give the tail of the next block;
+         //otherwise all of them give the current block
+         const size_t first_partition = m_direct_head ? 1 : 0;
+         const size_t newest_block = m_direct_head ? m_block_index + 1 : m_block_index;
+         std::fill(accumulator.begin(), accumulator.end(), Complex());
+         for (size_t p = first_partition; p < partitions; p++)
+         {
+            if (p > newest_block)
+               break;   //blocks before the stream start are silent
+            const Spectrum& input = m_delay_lines[pair][(newest_block - p) % partitions];
+            const Spectrum& filter = m_partitions[p];
+            for (size_t m = 0; m < size; m++)
+            {
+               const Complex& a = input[m];
+               const Complex& b = filter[m];
+               accumulator[m] += Complex(a.real()*b.real() - a.imag()*b.imag(), a.real()*b.imag() + a.imag()*b.real());
+            }
+         }
+         m_fft.Inverse(accumulator.data());
+
+         //only the second half is free of circular wraparound
+         for (size_t m = 0; m < m_block_size; m++)
+         {
+            m_tails[c0][m] = accumulator[m_block_size + m].real();
+            if (c1 < numChannels)
+               m_tails[c1][m] = accumulator[m_block_size + m].imag();
+         }
+      }
+
+      if (!m_direct_head)
+      {
+         for (size_t m = 0; m < m_block_size; m++)
+         {
+            SampleFrame frame;
+            for (size_t c = 0; c < numChannels; c++)
+               frame[c] = ToSample<SampleFormat>(m_tails[c][m]);
+            m_y.push_back(frame);
+         }
+      }
+
+      m_block_index++;
+   }
+
+   //writes count output frame pairs, silent ones until the latency has passed
+   void emit(size_type count, SampleFrame * out)
+   {
+      const ptrdiff_t latency = static_cast<ptrdiff_t>(Latency());
+      const ptrdiff_t halfWidth = table_width / 2;
+      for (size_type k = 0; k < count; k++, m_emitted++)
+      {
+         ptrdiff_t i = m_emitted - latency;
+         if (i < 0)
+         {
+            *out++ = SampleFrame{};
+            *out++ = SampleFrame{};
+         }
+         else
+         {
+            *out++ = inputFrame(i);
+            *out++ = m_y[static_cast<size_type>(i + halfWidth - m_y_first)];
+         }
+      }
+   }
+
+   //drops the input frames and FIR outputs no longer needed once they pile up
+   void discardUnneeded()
+   {
+      const ptrdiff_t next = m_emitted - static_cast<ptrdiff_t>(Latency());
+      const ptrdiff_t threshold = static_cast<ptrdiff_t>(table_width + 2 * m_block_size);
+
+      ptrdiff_t keep_input = std::min(next, m_received - 2 * static_cast<ptrdiff_t>(m_block_size));
+      if (keep_input - m_history_first > threshold)
+      {
+         m_history.erase(m_history.begin(), m_history.begin() + (keep_input - m_history_first));
+         m_history_first = keep_input;
+      }
+
+      ptrdiff_t keep_y = next + static_cast<ptrdiff_t>(table_width / 2);
+      if (keep_y - m_y_first > threshold)
+      {
+         m_y.erase(m_y.begin(), m_y.begin() + (keep_y - m_y_first));
+         m_y_first = keep_y;
+      }
+   }
+};
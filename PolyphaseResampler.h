@@ -0,0 +1,207 @@
+/*
+Polyphase Resampler
+
+Converts the sampling rate of a digital audio stream by an arbitrary rational
+ratio with filter tables designed like the Keiser window filter.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+#include "FastFilterDesign.h"
+#include <numeric>
+#include <string>
+
+/* Polyphase resampler
+Multiplies the sampling rate by up/down. Output frame n lies n*down/up input
+sample periods after the first input frame, at input frame i = n*down/up plus
+the fraction phase/up, where phase = n*down%up. It is calculated from the input
+frames i-halfWidth+1 to i+halfWidth with the table of its phase, so only the
+outputs that are needed are calculated and every table is used up times less
+often than a table of an up-times upsampler would be.
+
+The coefficient for an input frame dist sample periods away from the output is
+   scale*Keiser(dist/(halfWidth+1))*sinc(scale*dist)
+where scale = min(1, up/down) moves the cutoff to the output Nyquist frequency
+when the rate goes down. With a ratio of 2 the tables are those of SRDoubler:
+the first one passes the input through and the second one is CFilter. When
+the rate goes down the tables are widened by 1/scale to keep the transition
+band as narrow relative to the output rate as table_width makes it when the
+rate goes up. The tables are calculated with the fast filter design functions.
+
+There are up tables once the ratio is reduced, so a ratio such as 47999/44100
+would need tens of thousands of them and gigabytes of coefficients. Ratios
+whose reduced up term exceeds MAX_POLYPHASE_PHASES are rejected; that leaves
+every ratio between the usual rates, 640/147 from 44100 to 192000 being the
+largest. The tables also widen with down/up, and every output frame takes
+as many multiply-accumulates as a table is wide, so ratios whose tables would
+be wider than MAX_POLYPHASE_WIDTH are rejected as well; with the default
+table that still allows the rate to go down about 20 times.
+*/
+
+const size_t MAX_POLYPHASE_PHASES = 1024;
+const size_t MAX_POLYPHASE_WIDTH = 65536;
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class CPolyphaseResampler
+{
+public:
+   using Doubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename Doubler::SampleFrame;
+   using FrameSpan = typename Doubler::FrameSpan;
+   using FrameVector = typename Doubler::FrameVector;
+   using CoefficientFormat = typename Doubler::CoefficientFormat;
+   using size_type = typename Doubler::size_type;
+
+   CPolyphaseResampler(const FrameSpan& in_span, size_t up, size_t down, double alpha) : m_in_span{ in_span }
+   {
+      if (up == 0 || down == 0)
+         throw std::runtime_error("Resampling ratio terms should be positive");
+
+      size_t divisor = std::gcd(up, down);
+      m_up = up / divisor;
+      m_down = down / divisor;
+      if (m_up > MAX_POLYPHASE_PHASES)
+         throw std::runtime_error("The resampling ratio " + std::to_string(m_up) + "/" + std::to_string(m_down) + " needs more than " + std::to_string(MAX_POLYPHASE_PHASES) + " phase tables");
+      if (PhaseWidth(m_up, m_down) > MAX_POLYPHASE_WIDTH)
+         throw std::runtime_error("The resampling ratio " + std::to_string(m_up) + "/" + std::to_string(m_down) + " needs tables wider than " + std::to_string(MAX_POLYPHASE_WIDTH) + " frames");
+
+      designTables(alpha);
+   }
+
+   size_t Up() const
+   {
+      return m_up;
+   }
+
+   size_t Down() const
+   {
+      return m_down;
+   }
+
+   //input frames every phase table spans
+   size_t Width() const
+   {
+      return m_width;
+   }
+
+   //input frames every phase table of an up/down resampler spans
+   static size_t PhaseWidth(size_t up, size_t down)
+   {
+      const double scale = std::min(1., double(up) / double(down));
+      return static_cast<size_t>(std::ceil(table_width / scale / 2)) * 2;
+   }
+
+   //output frames the input yields, one for every output sampling moment before the end of the input
+   static size_type OutputFrames(size_type input_frames, size_t up, size_t down)
+   {
+      size_t divisor = std::gcd(up, down);
+      up /= divisor;
+      down /= divisor;
+      return static_cast<size_type>((static_cast<uint64_t>(input_frames) * up + down - 1) / down);
+   }
+
+   FrameVector Run() const
+   {
+      FrameVector output(OutputFrames(m_in_span.size(), m_up, m_down));
+
+      run(output.data(), output.size());
+
+      return output;
+   }
+
+   void Run(FrameSpan& out_span) const
+   {
+      size_type frames = OutputFrames(m_in_span.size(), m_up, m_down);
+      if (out_span.size() < frames)
+         throw std::runtime_error("Output span is too short");
+
+      run(out_span.data(), frames);
+   }
+
+private:
+
+   const FrameSpan& m_in_span;
+   size_t m_up;
+   size_t m_down;
+   size_t m_width;                                //an even number of input frames
+   std::vector<CoefficientFormat> m_tables;       //m_up tables of m_width coefficients each, ordered by phase
+   DotKernel<SampleFormat, CoefficientFormat, numChannels> m_kernel = SelectDotKernel<SampleFormat, CoefficientFormat, numChannels>();
+
+   void designTables(double alpha)
+   {
+      const double scale = std::min(1., double(m_up) / double(m_down));
+      m_width = PhaseWidth(m_up, m_down);
+      const size_t halfWidth = m_width / 2;
+      const CPolynomialI0 poly{ alpha };
+      const double inverse_I0_alpha = 1. / poly(alpha * alpha / 4);
+
+      //the phases are independent, so large sets of tables are split between threads
+      m_tables.resize(m_up * m_width);
+      DesignInParallel(m_up, m_width, std::thread::hardware_concurrency(), [&](size_t first, size_t last)
+      {
+         std::vector<double> x(m_width), window(m_width), sincs(m_width);
+         for (size_t phase = first; phase < last; phase++)
+         {
+            //input frame k of the table is |k-offset| input sample periods away from the output
+            const double offset = double(halfWidth - 1) + double(phase) / m_up;
+            for (size_t k = 0; k < m_width; k++)
+               x[k] = std::abs(double(k) - offset) / (halfWidth + 1);
+            FastKaiser(poly, alpha, inverse_I0_alpha, x.data(), window.data(), m_width);
+            FastSinc(-scale * offset, scale, m_width, sincs.data());
+
+            for (size_t k = 0; k < m_width; k++)
+               m_tables[phase * m_width + k] = QuantizeCoefficient<CoefficientFormat>(scale * window[k] * sincs[k]);
+         }
+      });
+   }
+
+   SampleFrame dot(const SampleFrame * in, const CoefficientFormat * coefs) const
+   {
+      AccumulatorFormat<CoefficientFormat> sums[numChannels];
+      m_kernel(&in[0][0], coefs, m_width, sums);
+
+      SampleFrame frame;
+      for (size_t c = 0; c < numChannels; c++)
+         frame[c] = ToSample<SampleFormat>(sums[c]);
+      return frame;
+   }
+
+   void run(SampleFrame * out, size_type frames) const
+   {
+      const ptrdiff_t in_frames = static_cast<ptrdiff_t>(m_in_span.size());
+      const ptrdiff_t width = static_cast<ptrdiff_t>(m_width);
+      const SampleFrame * in = m_in_span.data();
+      FrameVector padded(m_width);   //zero padded copy of the input near its ends
+
+      for (size_type n = 0; n < frames; n++)
+      {
+         uint64_t position = static_cast<uint64_t>(n) * m_down;
+         ptrdiff_t first = static_cast<ptrdiff_t>(position / m_up) - (width / 2 - 1);
+         const CoefficientFormat * table = m_tables.data() + (position % m_up) * m_width;
+
+         if (first >= 0 && first + width <= in_frames)
+         {
+            out[n] = dot(in + first, table);
+         }
+         else
+         {
+            for (ptrdiff_t k = 0; k < width; k++)
+               padded[k] = (first + k >= 0 && first + k < in_frames) ? in[first + k] : SampleFrame{};
+            out[n] = dot(padded.data(), table);
+         }
+      }
+   }
+};
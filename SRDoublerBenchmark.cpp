@@ -0,0 +1,453 @@
+/*
+SRDoubler Benchmark
+
+This program measures how fast SRDoubler upsamples with various filter table
+widths, channel counts, sample formats and input lengths, and reports the
+results as JSON, so that runs can be compared to catch regressions and to
+compare kernels.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+#include "FileUpsampler.h"
+#include "FastFilterDesign.h"
+#include "FilterQuality.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+const double ALPHA = 9;                      //parameter of a Kaiser function
+const double SIGNAL_FREQUENCY = 0.01;        //of the benchmark sine wave, in cycles per frame
+
+/* Measurements
+Every combination of a table width, a channel count, a sample format and an
+input length is upsampled with both Run() overloads: the one that returns a
+new vector, which includes allocating and zeroing the output, and the one
+that writes into a span allocated beforehand. A combination is run once
+untimed, which faults the buffers in and warms the caches, and then
+repetitions times. The JSON report gives every repetition and their
+statistics in nanoseconds per output frame, together with two throughputs
+derived from the median:
+
+gflops       the arithmetic of the filter, 3 operations (fold, multiply and
+             add) per coefficient of every interpolated sample
+bandwidth    the samples read and written per second, in GB; the filter
+             table and the input halo are cache resident and not counted
+*/
+
+struct SBenchmarkOptions
+{
+   std::vector<size_t> widths{ 64, 256, 1024, 3200, 8192, 16384 };
+   std::vector<size_t> channels{ 1, 2, 8 };
+   std::vector<std::string> formats{ "double", "float", "int16", "int32" };
+   std::vector<size_t> lengths{ 4096, 65536 };
+   unsigned repetitions = 5;
+   const char * output = nullptr;   //the JSON goes to stdout unless a file is given
+   bool pareto = false;             //measure the quality of filter configurations instead
+   bool widths_given = false;
+   std::vector<double> alphas{ 5, 7, 9, 11, 13 };
+};
+
+struct SBenchmarkResult
+{
+   std::string format;
+   size_t table_width;
+   size_t channels;
+   size_t frames;          //input frames
+   const char * overload;
+   size_t sample_bytes;
+   std::vector<double> seconds;
+};
+
+static volatile double g_sink;   //keeps the compiler from discarding the output
+
+template<typename SampleFormat> static SampleFormat sineSample(size_t frame, size_t channel)
+{
+   double value = 0.5 * sin(2 * PI * SIGNAL_FREQUENCY * (frame + channel * 0.25));
+   if constexpr (std::is_integral<SampleFormat>::value)
+      return static_cast<SampleFormat>(value * static_cast<double>(std::numeric_limits<SampleFormat>::max()));
+   else
+      return static_cast<SampleFormat>(value);
+}
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width>
+static void measure(const char * format, size_t width, size_t frames, unsigned repetitions, std::vector<SBenchmarkResult>& results)
+{
+   using SRDoublerType = SRDoubler<SampleFormat, numChannels, table_width>;
+   using CoefficientFormat = typename SRDoublerType::CoefficientFormat;
+   using FrameVector = typename SRDoublerType::FrameVector;
+   using FrameSpan = typename SRDoublerType::FrameSpan;
+
+   std::vector<CoefficientFormat> coefficients(width / 2);
+   FastKeiserHalfTable(ALPHA, width / 2, coefficients.data());
+
+   FrameVector input(frames);
+   for (size_t frame = 0; frame < frames; frame++)
+      for (size_t c = 0; c < numChannels; c++)
+         input[frame][c] = sineSample<SampleFormat>(frame, c);
+   FrameSpan input_span{ input };
+   SRDoublerType doubler{ input_span, coefficients.data(), width };
+
+   FrameVector output(2 * frames);
+   FrameSpan output_span{ output };
+
+   SBenchmarkResult returning{ format, width, numChannels, frames, "Run()", sizeof(SampleFormat), {} };
+   SBenchmarkResult in_place{ format, width, numChannels, frames, "Run(FrameSpan&)", sizeof(SampleFormat), {} };
+
+   for (unsigned repetition = 0; repetition <= repetitions; repetition++)
+   {
+      auto start = std::chrono::steady_clock::now();
+      FrameVector returned = doubler.Run();
+      auto middle = std::chrono::steady_clock::now();
+      doubler.Run(output_span);
+      auto end = std::chrono::steady_clock::now();
+
+      g_sink = g_sink + static_cast<double>(returned[frames - 1][0]) + static_cast<double>(output[2 * frames - 1][numChannels - 1]);
+      if (repetition == 0)
+         continue;   //the warm-up run
+      returning.seconds.push_back(std::chrono::duration<double>(middle - start).count());
+      in_place.seconds.push_back(std::chrono::duration<double>(end - middle).count());
+   }
+
+   results.push_back(std::move(returning));
+   results.push_back(std::move(in_place));
+}
+
+//any even width can be measured: the standard ones on the doublers compiled for them, the others on doublers of DYNAMIC_TABLE_WIDTH
+static bool supportedWidth(size_t table_width)
+{
+   return table_width >= 4 && table_width % 2 == 0;
+}
+
+template<typename SampleFormat, uint8_t numChannels>
+static bool measureWidth(const char * format, size_t table_width, size_t frames, unsigned repetitions, std::vector<SBenchmarkResult>& results)
+{
+   if (!supportedWidth(table_width))
+      return false;
+   DispatchTableWidth(table_width, [&](auto width) { measure<SampleFormat, numChannels, decltype(width)::value>(format, table_width, frames, repetitions, results); });
+   return true;
+}
+
+template<typename SampleFormat>
+static bool measureChannels(const char * format, size_t channels, size_t table_width, size_t frames, unsigned repetitions, std::vector<SBenchmarkResult>& results)
+{
+   switch (channels)
+   {
+   case 1: return measureWidth<SampleFormat, 1>(format, table_width, frames, repetitions, results);
+   case 2: return measureWidth<SampleFormat, 2>(format, table_width, frames, repetitions, results);
+   case 4: return measureWidth<SampleFormat, 4>(format, table_width, frames, repetitions, results);
+   case 6: return measureWidth<SampleFormat, 6>(format, table_width, frames, repetitions, results);
+   case 8: return measureWidth<SampleFormat, 8>(format, table_width, frames, repetitions, results);
+   }
+   return false;
+}
+
+static bool measureFormat(const std::string& format, size_t channels, size_t table_width, size_t frames, unsigned repetitions, std::vector<SBenchmarkResult>& results)
+{
+   if (format == "double")
+      return measureChannels<double>("double", channels, table_width, frames, repetitions, results);
+   else if (format == "float")
+      return measureChannels<float>("float", channels, table_width, frames, repetitions, results);
+   else if (format == "int16")
+      return measureChannels<int16_t>("int16", channels, table_width, frames, repetitions, results);
+   else if (format == "int32")
+      return measureChannels<int32_t>("int32", channels, table_width, frames, repetitions, results);
+   return false;
+}
+
+static std::vector<std::string> splitList(const char * list)
+{
+   std::vector<std::string> items;
+   std::stringstream stream{ list };
+   std::string item;
+   while (std::getline(stream, item, ','))
+      if (!item.empty())
+         items.push_back(item);
+   return items;
+}
+
+//false unless the list has items and every one of them is a positive integer
+static bool splitNumbers(const char * list, std::vector<size_t>& numbers)
+{
+   numbers.clear();
+   for (const std::string& item : splitList(list))
+   {
+      char * end = nullptr;
+      errno = 0;
+      unsigned long long number = strtoull(item.c_str(), &end, 10);
+      if (*end != '\0' || errno == ERANGE || item.find('-') != std::string::npos || number == 0)
+         return false;
+      numbers.push_back(static_cast<size_t>(number));
+   }
+   return !numbers.empty();
+}
+
+//false unless the list has items and every one of them is a positive number
+static bool splitAlphas(const char * list, std::vector<double>& alphas)
+{
+   alphas.clear();
+   for (const std::string& item : splitList(list))
+   {
+      char * end = nullptr;
+      double alpha = strtod(item.c_str(), &end);
+      if (*end != '\0' || !std::isfinite(alpha) || alpha <= 0)
+         return false;
+      alphas.push_back(alpha);
+   }
+   return !alphas.empty();
+}
+
+static void printUsage()
+{
+   std::cerr << "Usage: SRDoublerBenchmark [--quick] [--widths 64,256,...] [--channels 1,2,...] [--formats double,float,int16,int32]\n"
+                "                          [--lengths 4096,...] [--repetitions n] [--output report.json]\n"
+                "       SRDoublerBenchmark --pareto [--widths 64,256,...] [--alphas 5,7,...] [--repetitions n] [--output report.json]\n";
+}
+
+static void writeResult(std::ostream& out, const SBenchmarkResult& result)
+{
+   std::vector<double> ns_per_frame;
+   const double output_frames = 2. * result.frames;
+   for (double seconds : result.seconds)
+      ns_per_frame.push_back(seconds * 1E9 / output_frames);
+
+   std::vector<double> sorted = ns_per_frame;
+   std::sort(sorted.begin(), sorted.end());
+   size_t count = sorted.size();
+   double median = (count % 2) ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+   double mean = std::accumulate(sorted.begin(), sorted.end(), 0.) / count;
+   double variance = 0;
+   for (double value : sorted)
+      variance += (value - mean) * (value - mean);
+   variance = (count > 1) ? variance / (count - 1) : 0.;
+
+   const double median_seconds = median * output_frames * 1E-9;
+   const double operations = 3. * (result.table_width / 2) * result.channels * result.frames;
+   const double bytes = 3. * result.sample_bytes * result.channels * result.frames;   //every input sample is read once and two output samples are written
+
+   out << "    { \"format\": \"" << result.format << "\", \"table_width\": " << result.table_width
+       << ", \"channels\": " << result.channels << ", \"input_frames\": " << result.frames
+       << ", \"overload\": \"" << result.overload << "\",\n";
+   out << "      \"ns_per_output_frame\": { \"median\": " << median << ", \"mean\": " << mean << ", \"min\": " << sorted.front()
+       << ", \"max\": " << sorted.back() << ", \"variance\": " << variance << ", \"stddev\": " << std::sqrt(variance) << ", \"samples\": [";
+   for (size_t i = 0; i < ns_per_frame.size(); i++)
+      out << (i ? ", " : "") << ns_per_frame[i];
+   out << "] },\n";
+   out << "      \"gflops\": " << operations / median_seconds * 1E-9 << ", \"bandwidth_gbs\": " << bytes / median_seconds * 1E-9 << " }";
+}
+
+static void writeReport(std::ostream& out, const SBenchmarkOptions& options, const std::vector<SBenchmarkResult>& results)
+{
+   out.precision(6);
+   out << "{\n";
+   out << "  \"simd\": \"" << SimdLevelName(ActiveSimdLevel()) << "\",\n";
+   out << "  \"repetitions\": " << options.repetitions << ",\n";
+   out << "  \"alpha\": " << ALPHA << ",\n";
+   out << "  \"results\": [\n";
+   for (size_t i = 0; i < results.size(); i++)
+   {
+      writeResult(out, results[i]);
+      out << ((i + 1 < results.size()) ? ",\n" : "\n");
+   }
+   out << "  ]\n}\n";
+}
+
+/* Quality versus throughput
+With --pareto the benchmark measures every combination of a table width and
+an alpha with CFilterQualityMeter instead, by default over ALL_WIDTHS, which
+DispatchTableWidth() runs on compiled or dynamic width doublers like any
+other. A configuration is on the Pareto front if no other one is both at
+least as fast and at least as good in its worst artifact level, and better
+in one of them; the speed is measured once per table width, since alpha
+doesn't change the work. For every quality tier, a limit on the worst
+artifact level, the report names the fastest configuration that meets it,
+which is the one to use for that tier.
+*/
+
+const double QUALITY_TIERS[] = { -60, -80, -100, -120, -140 };   //dB
+const std::vector<size_t> ALL_WIDTHS{ 64, 128, 256, 512, 1024, 2048, 3200, 4096, 8192, 16384 };
+
+static void writeParetoReport(std::ostream& out, const std::vector<SFilterQuality>& configurations)
+{
+   auto dominates = [](const SFilterQuality& a, const SFilterQuality& b)
+   {
+      return a.frames_per_second >= b.frames_per_second && a.WorstDb() <= b.WorstDb() &&
+             (a.frames_per_second > b.frames_per_second || a.WorstDb() < b.WorstDb());
+   };
+
+   out.precision(6);
+   out << "{\n";
+   out << "  \"simd\": \"" << SimdLevelName(ActiveSimdLevel()) << "\",\n";
+   out << "  \"sample_rate\": " << QUALITY_SAMPLE_RATE << ",\n";
+   out << "  \"passband_edge\": " << PASSBAND_EDGE << ",\n";
+   out << "  \"configurations\": [\n";
+   for (size_t i = 0; i < configurations.size(); i++)
+   {
+      const SFilterQuality& quality = configurations[i];
+      bool pareto = std::none_of(configurations.begin(), configurations.end(), [&](const SFilterQuality& other) { return dominates(other, quality); });
+      out << "    { \"table_width\": " << quality.table_width << ", \"alpha\": " << quality.alpha
+          << ", \"stopband_db\": " << quality.stopband_db << ", \"passband_ripple_db\": " << quality.passband_ripple_db
+          << ", \"imaging_db\": " << quality.imaging_db << ",\n      \"thdn_multitone_db\": " << quality.thdn_multitone_db
+          << ", \"thdn_sweep_db\": " << quality.thdn_sweep_db << ", \"worst_db\": " << quality.WorstDb()
+          << ", \"frames_per_second\": " << quality.frames_per_second << ", \"pareto\": " << (pareto ? "true" : "false") << " }"
+          << ((i + 1 < configurations.size()) ? ",\n" : "\n");
+   }
+   out << "  ],\n";
+   out << "  \"tiers\": [\n";
+   for (size_t tier = 0; tier < sizeof(QUALITY_TIERS) / sizeof(QUALITY_TIERS[0]); tier++)
+   {
+      const SFilterQuality * cheapest = nullptr;
+      for (const SFilterQuality& quality : configurations)
+         if (quality.WorstDb() <= QUALITY_TIERS[tier] && (!cheapest || quality.frames_per_second > cheapest->frames_per_second ||
+             (quality.frames_per_second == cheapest->frames_per_second && quality.WorstDb() < cheapest->WorstDb())))
+            cheapest = &quality;
+
+      out << "    { \"limit_db\": " << QUALITY_TIERS[tier];
+      if (cheapest)
+         out << ", \"table_width\": " << cheapest->table_width << ", \"alpha\": " << cheapest->alpha << ", \"worst_db\": " << cheapest->WorstDb()
+             << ", \"frames_per_second\": " << cheapest->frames_per_second << " }";
+      else
+         out << ", \"table_width\": null }";
+      out << ((tier + 1 < sizeof(QUALITY_TIERS) / sizeof(QUALITY_TIERS[0])) ? ",\n" : "\n");
+   }
+   out << "  ]\n}\n";
+}
+
+static bool measurePareto(const SBenchmarkOptions& options, std::vector<SFilterQuality>& configurations)
+{
+   for (size_t table_width : options.widths_given ? options.widths : ALL_WIDTHS)
+   {
+      std::cerr << "Table width " << table_width << "\n";
+      if (!supportedWidth(table_width) || table_width > MAX_QUALITY_WIDTH)
+      {
+         std::cerr << "The table widths should be even numbers from 4 to " << MAX_QUALITY_WIDTH << "\n";
+         return false;
+      }
+      DispatchTableWidth(table_width, [&](auto width)
+      {
+         using MeterType = CFilterQualityMeter<decltype(width)::value>;
+         const double frames_per_second = MeterType{ options.alphas.front(), table_width }.MeasureThroughput(options.repetitions);
+         for (double alpha : options.alphas)
+         {
+            configurations.push_back(MeterType{ alpha, table_width }.Measure());
+            configurations.back().frames_per_second = frames_per_second;
+         }
+      });
+   }
+   return true;
+}
+
+//writes the report to the output file or to stdout
+template<typename Writer> static int writeOutput(const SBenchmarkOptions& options, Writer writer)
+{
+   if (options.output)
+   {
+      std::ofstream file{ options.output };
+      writer(file);
+      if (!file)
+      {
+         std::cerr << "Failure to write " << options.output << "\n";
+         return -1;
+      }
+   }
+   else
+      writer(std::cout);
+
+   return 0;
+}
+
+int main(int argc, char ** argv)
+{
+   SBenchmarkOptions options;
+
+   for (int arg = 1; arg < argc; arg++)
+   {
+      std::string option{ argv[arg] };
+      if (option == "--quick")
+      {
+         options.lengths = { 4096 };
+         options.repetitions = 3;
+         continue;
+      }
+      if (option == "--pareto")
+      {
+         options.pareto = true;
+         continue;
+      }
+      if (arg + 1 >= argc)
+      {
+         printUsage();
+         return -1;
+      }
+      const char * value = argv[++arg];
+      bool valid = true;
+      if (option == "--widths")
+      {
+         valid = splitNumbers(value, options.widths);
+         options.widths_given = true;
+      }
+      else if (option == "--channels")
+         valid = splitNumbers(value, options.channels);
+      else if (option == "--formats")
+         valid = !(options.formats = splitList(value)).empty();
+      else if (option == "--lengths")
+         valid = splitNumbers(value, options.lengths);
+      else if (option == "--repetitions")
+         options.repetitions = std::max(1, atoi(value));
+      else if (option == "--output")
+         options.output = value;
+      else if (option == "--alphas")
+         valid = splitAlphas(value, options.alphas);
+      else
+      {
+         std::cerr << "Unknown option " << option << "\n";
+         return -1;
+      }
+      if (!valid)
+      {
+         std::cerr << "The values of " << option << " should be a comma separated list of positive numbers\n";
+         printUsage();
+         return -1;
+      }
+   }
+
+   if (options.pareto)
+   {
+      std::vector<SFilterQuality> configurations;
+      if (!measurePareto(options, configurations))
+         return -1;
+      return writeOutput(options, [&](std::ostream& out) { writeParetoReport(out, configurations); });
+   }
+
+   std::vector<SBenchmarkResult> results;
+   for (const std::string& format : options.formats)
+      for (size_t channels : options.channels)
+         for (size_t table_width : options.widths)
+            for (size_t frames : options.lengths)
+            {
+               std::cerr << format << ", " << channels << " channel(s), table width " << table_width << ", " << frames << " frames\n";
+               if (!measureFormat(format, channels, table_width, frames, options.repetitions, results))
+               {
+                  std::cerr << "The combination isn't supported; the formats are double, float, int16 and int32, the channel counts 1, 2, 4, 6 and 8\n"
+                               "and the table widths even numbers from 4 up\n";
+                  return -1;
+               }
+            }
+
+   return writeOutput(options, [&](std::ostream& out) { writeReport(out, options, results); });
+}
@@ -0,0 +1,700 @@
+/*
+SIMD Kernels
+
+Vectorized dot products used by SRDoubler to calculate interpolated frames.
+The kernels are compiled for several instruction sets and the fastest one
+supported by the processor is selected at run time.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define SRD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+//GCC and Clang refuse to inline intrinsics into functions compiled for a lower instruction set
+#if defined(__GNUC__) || defined(__clang__)
+#define SRD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SRD_TARGET(isa)
+#endif
+
+enum class SimdLevel { Scalar, SSE2, AVX2, AVX512 };
+
+inline const char * SimdLevelName(SimdLevel level)
+{
+   switch (level)
+   {
+   case SimdLevel::SSE2:   return "SSE2";
+   case SimdLevel::AVX2:   return "AVX2";
+   case SimdLevel::AVX512: return "AVX-512";
+   default:                return "scalar";
+   }
+}
+
+//queries CPUID for the best instruction set both the processor and the OS support
+inline SimdLevel DetectSimdLevel()
+{
+#ifdef SRD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+   int regs[4];
+   __cpuid(regs, 0);
+   int max_leaf = regs[0];
+   __cpuid(regs, 1);
+   bool sse2 = (regs[3] & (1 << 26)) != 0;
+   bool fma = (regs[2] & (1 << 12)) != 0;
+   bool osxsave = (regs[2] & (1 << 27)) != 0;
+   unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+   bool avx2 = false, avx512 = false;
+   if (max_leaf >= 7)
+   {
+      __cpuidex(regs, 7, 0);
+      avx2 = (regs[1] & (1 << 5)) != 0 && fma && (xcr0 & 0x6) == 0x6;
+      avx512 = (regs[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+   }
+#else
+   __builtin_cpu_init();
+   bool sse2 = __builtin_cpu_supports("sse2");
+   bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+   bool avx512 = __builtin_cpu_supports("avx512f");
+#endif
+   if (avx512)
+      return SimdLevel::AVX512;
+   else if (avx2)
+      return SimdLevel::AVX2;
+   else if (sse2)
+      return SimdLevel::SSE2;
+#endif
+   return SimdLevel::Scalar;
+}
+
+//the detected level, optionally capped by the SRDOUBLER_SIMD environment variable (scalar, sse2, avx2)
+inline SimdLevel ActiveSimdLevel()
+{
+   static const SimdLevel level = []()
+   {
+      SimdLevel detected = DetectSimdLevel();
+      const char * cap = std::getenv("SRDOUBLER_SIMD");
+      if (cap)
+      {
+         SimdLevel requested = SimdLevel::AVX512;
+         if (!std::strcmp(cap, "scalar"))
+            requested = SimdLevel::Scalar;
+         else if (!std::strcmp(cap, "sse2"))
+            requested = SimdLevel::SSE2;
+         else if (!std::strcmp(cap, "avx2"))
+            requested = SimdLevel::AVX2;
+         if (requested < detected)
+            detected = requested;
+      }
+      return detected;
+   }();
+   return level;
+}
+
+/* Fixed point coefficients
+Integer samples are filtered with int32_t coefficients holding their values
+multiplied by 2^FIXED_POINT_BITS. Products are accumulated in int64_t, which
+leaves enough headroom for the sum of any table applied to full scale 32 bit
+samples. Floating point coefficients are accumulated in double.
+*/
+
+const int FIXED_POINT_BITS = 28;
+
+template<typename CoefficientFormat>
+using AccumulatorFormat = typename std::conditional<std::is_integral<CoefficientFormat>::value, int64_t, double>::type;
+
+/* Folded dot product kernels
+For every channel c, a kernel calculates
+   out[c] = sum over dist from 0 to count-1 of coefs[dist]*(back[c - dist*channels] + fwd[c + dist*channels])
+where back points to the last input frame before the interpolated point and fwd to the first one after it.
+Samples and coefficients are widened to double and accumulated in double precision regardless of their
+format, so float data costs half the memory bandwidth without losing accuracy in long sums. Fixed point
+data is widened to int64_t instead.
+*/
+
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+using FoldedKernel = void(*)(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, AccumulatorFormat<CoefficientFormat> * out);
+
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+inline void FoldedDotScalar(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, AccumulatorFormat<CoefficientFormat> * out)
+{
+   using Accumulator = AccumulatorFormat<CoefficientFormat>;
+
+   Accumulator acc[channels]{};
+   for (size_t dist = 0; dist < count; dist++)
+   {
+      for (size_t c = 0; c < channels; c++)
+         acc[c] += Accumulator(coefs[dist]) * (Accumulator(back[c]) + Accumulator(fwd[c]));
+      back -= channels;
+      fwd += channels;
+   }
+   for (size_t c = 0; c < channels; c++)
+      out[c] = acc[c];
+}
+
+#ifdef SRD_X86
+
+namespace simd_kernels {
+
+   /* SSE2 */
+
+   SRD_TARGET("sse2") inline __m128d load2(const double * p) { return _mm_loadu_pd(p); }
+   SRD_TARGET("sse2") inline __m128d load2(const float * p) { return _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(p)))); }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("sse2") void MonoSSE2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      __m128d acc = _mm_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 2 <= count; dist += 2)
+      {
+         __m128d b = load2(back - dist - 1);
+         b = _mm_shuffle_pd(b, b, 1);   //restore the order of distances
+         acc = _mm_add_pd(acc, _mm_mul_pd(load2(coefs + dist), _mm_add_pd(b, load2(fwd + dist))));
+      }
+      double sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+      for (; dist < count; dist++)
+         sum += double(coefs[dist]) * (double(*(back - dist)) + double(fwd[dist]));
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("sse2") void StereoSSE2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //a stereo frame occupies exactly one 128 bit register
+      __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 2 <= count; dist += 2)
+      {
+         acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_set1_pd(double(coefs[dist])), _mm_add_pd(load2(back - 2 * dist), load2(fwd + 2 * dist))));
+         acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_set1_pd(double(coefs[dist + 1])), _mm_add_pd(load2(back - 2 * dist - 2), load2(fwd + 2 * dist + 2))));
+      }
+      for (; dist < count; dist++)
+         acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_set1_pd(double(coefs[dist])), _mm_add_pd(load2(back - 2 * dist), load2(fwd + 2 * dist))));
+      _mm_storeu_pd(out, _mm_add_pd(acc0, acc1));
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+   SRD_TARGET("sse2") void MultichannelSSE2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //a frame of an even number of channels fills channels/2 registers
+      static_assert(channels % 2 == 0, "the channel count should be even");
+      __m128d acc[channels / 2];
+      for (size_t r = 0; r < channels / 2; r++)
+         acc[r] = _mm_setzero_pd();
+      for (size_t dist = 0; dist < count; dist++)
+      {
+         __m128d c = _mm_set1_pd(double(coefs[dist]));
+         for (size_t r = 0; r < channels / 2; r++)
+            acc[r] = _mm_add_pd(acc[r], _mm_mul_pd(c, _mm_add_pd(load2(back + 2 * r), load2(fwd + 2 * r))));
+         back -= channels;
+         fwd += channels;
+      }
+      for (size_t r = 0; r < channels / 2; r++)
+         _mm_storeu_pd(out + 2 * r, acc[r]);
+   }
+
+   /* AVX2 */
+
+   SRD_TARGET("avx2,fma") inline __m256d load4(const double * p) { return _mm256_loadu_pd(p); }
+   SRD_TARGET("avx2,fma") inline __m256d load4(const float * p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx2,fma") void MonoAVX2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 8 <= count; dist += 8)
+      {
+         __m256d b0 = _mm256_permute4x64_pd(load4(back - dist - 3), 0x1B);
+         __m256d b1 = _mm256_permute4x64_pd(load4(back - dist - 7), 0x1B);
+         acc0 = _mm256_fmadd_pd(load4(coefs + dist), _mm256_add_pd(b0, load4(fwd + dist)), acc0);
+         acc1 = _mm256_fmadd_pd(load4(coefs + dist + 4), _mm256_add_pd(b1, load4(fwd + dist + 4)), acc1);
+      }
+      acc0 = _mm256_add_pd(acc0, acc1);
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+      double sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+      for (; dist < count; dist++)
+         sum += double(coefs[dist]) * (double(*(back - dist)) + double(fwd[dist]));
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx2,fma") void StereoAVX2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //two stereo frames per register; backward pairs have their 128 bit halves swapped
+      __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 4 <= count; dist += 4)
+      {
+         __m256d b0 = _mm256_permute2f128_pd(load4(back - 2 * dist - 2), load4(back - 2 * dist - 2), 0x01);
+         __m256d b1 = _mm256_permute2f128_pd(load4(back - 2 * dist - 6), load4(back - 2 * dist - 6), 0x01);
+         __m256d c0 = _mm256_permute4x64_pd(_mm256_castpd128_pd256(load2(coefs + dist)), 0x50);
+         __m256d c1 = _mm256_permute4x64_pd(_mm256_castpd128_pd256(load2(coefs + dist + 2)), 0x50);
+         acc0 = _mm256_fmadd_pd(c0, _mm256_add_pd(b0, load4(fwd + 2 * dist)), acc0);
+         acc1 = _mm256_fmadd_pd(c1, _mm256_add_pd(b1, load4(fwd + 2 * dist + 4)), acc1);
+      }
+      acc0 = _mm256_add_pd(acc0, acc1);
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+      for (; dist < count; dist++)
+         acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(double(coefs[dist])), _mm_add_pd(load2(back - 2 * dist), load2(fwd + 2 * dist))));
+      _mm_storeu_pd(out, acc);
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+   SRD_TARGET("avx2,fma") void MultichannelAVX2(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //a frame fills channels/4 registers, and 6 channel frames have a pair left over for a 128 bit register
+      static_assert(channels % 2 == 0 && channels >= 4, "the channel count should be even and at least 4");
+      const size_t quads = channels / 4;
+      const bool pair = channels % 4 != 0;
+      __m256d acc[quads];
+      for (size_t r = 0; r < quads; r++)
+         acc[r] = _mm256_setzero_pd();
+      __m128d acc_pair = _mm_setzero_pd();
+      for (size_t dist = 0; dist < count; dist++)
+      {
+         __m256d c = _mm256_set1_pd(double(coefs[dist]));
+         for (size_t r = 0; r < quads; r++)
+            acc[r] = _mm256_fmadd_pd(c, _mm256_add_pd(load4(back + 4 * r), load4(fwd + 4 * r)), acc[r]);
+         if (pair)
+            acc_pair = _mm_fmadd_pd(_mm256_castpd256_pd128(c), _mm_add_pd(load2(back + 4 * quads), load2(fwd + 4 * quads)), acc_pair);
+         back -= channels;
+         fwd += channels;
+      }
+      for (size_t r = 0; r < quads; r++)
+         _mm256_storeu_pd(out + 4 * r, acc[r]);
+      if (pair)
+         _mm_storeu_pd(out + 4 * quads, acc_pair);
+   }
+
+   /* AVX-512 */
+
+   SRD_TARGET("avx512f,avx2,fma") inline __m512d load8(const double * p) { return _mm512_loadu_pd(p); }
+   SRD_TARGET("avx512f,avx2,fma") inline __m512d load8(const float * p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx512f,avx2,fma") void MonoAVX512(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      const __m512i reverse = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+      __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 16 <= count; dist += 16)
+      {
+         __m512d b0 = _mm512_permutexvar_pd(reverse, load8(back - dist - 7));
+         __m512d b1 = _mm512_permutexvar_pd(reverse, load8(back - dist - 15));
+         acc0 = _mm512_fmadd_pd(load8(coefs + dist), _mm512_add_pd(b0, load8(fwd + dist)), acc0);
+         acc1 = _mm512_fmadd_pd(load8(coefs + dist + 8), _mm512_add_pd(b1, load8(fwd + dist + 8)), acc1);
+      }
+      acc0 = _mm512_add_pd(acc0, acc1);
+      __m256d acc4 = _mm256_add_pd(_mm512_castpd512_pd256(acc0), _mm512_extractf64x4_pd(acc0, 1));
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc4), _mm256_extractf128_pd(acc4, 1));
+      double sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+      for (; dist < count; dist++)
+         sum += double(coefs[dist]) * (double(*(back - dist)) + double(fwd[dist]));
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx512f,avx2,fma") void StereoAVX512(const SampleFormat * back, const SampleFormat * fwd, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //four stereo frames per register
+      const __m512i reverse_frames = _mm512_set_epi64(1, 0, 3, 2, 5, 4, 7, 6);
+      const __m512i duplicate = _mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0);
+      __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+      size_t dist = 0;
+      for (; dist + 8 <= count; dist += 8)
+      {
+         __m512d b0 = _mm512_permutexvar_pd(reverse_frames, load8(back - 2 * dist - 6));
+         __m512d b1 = _mm512_permutexvar_pd(reverse_frames, load8(back - 2 * dist - 14));
+         __m512d c0 = _mm512_permutexvar_pd(duplicate, _mm512_broadcast_f64x4(load4(coefs + dist)));
+         __m512d c1 = _mm512_permutexvar_pd(duplicate, _mm512_broadcast_f64x4(load4(coefs + dist + 4)));
+         acc0 = _mm512_fmadd_pd(c0, _mm512_add_pd(b0, load8(fwd + 2 * dist)), acc0);
+         acc1 = _mm512_fmadd_pd(c1, _mm512_add_pd(b1, load8(fwd + 2 * dist + 8)), acc1);
+      }
+      acc0 = _mm512_add_pd(acc0, acc1);
+      __m256d acc4 = _mm256_add_pd(_mm512_castpd512_pd256(acc0), _mm512_extractf64x4_pd(acc0, 1));
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc4), _mm256_extractf128_pd(acc4, 1));
+      for (; dist < count; dist++)
+         acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(double(coefs[dist])), _mm_add_pd(load2(back - 2 * dist), load2(fwd + 2 * dist))));
+      _mm_storeu_pd(out, acc);
+   }
+}
+
+#endif
+
+#ifdef SRD_X86
+
+namespace simd_kernels {
+
+   /* Fixed point AVX2
+   Samples and coefficients are sign extended to 64 bit lanes, and _mm256_mul_epi32 multiplies
+   their low halves into exact 64 bit products. The two frames at the same distance are
+   multiplied separately, since the sum of two 32 bit samples may not fit into 32 bits.
+   */
+
+   SRD_TARGET("avx2") inline __m256i load4i(const int16_t * p) { return _mm256_cvtepi16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))); }
+   SRD_TARGET("avx2") inline __m256i load4i(const int32_t * p) { return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+
+   SRD_TARGET("avx2") inline __m256i multiplyAdd(__m256i c, __m256i b, __m256i f, __m256i acc)
+   {
+      return _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_mul_epi32(c, b), _mm256_mul_epi32(c, f)));
+   }
+
+   template<typename SampleFormat>
+   SRD_TARGET("avx2") void FixedMonoAVX2(const SampleFormat * back, const SampleFormat * fwd, const int32_t * coefs, size_t count, int64_t * out)
+   {
+      __m256i acc = _mm256_setzero_si256();
+      size_t dist = 0;
+      for (; dist + 4 <= count; dist += 4)
+      {
+         __m256i b = _mm256_permute4x64_epi64(load4i(back - dist - 3), 0x1B);
+         acc = multiplyAdd(load4i(coefs + dist), b, load4i(fwd + dist), acc);
+      }
+      alignas(32) int64_t lanes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+      int64_t sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+      for (; dist < count; dist++)
+         sum += int64_t(coefs[dist]) * int64_t(*(back - dist)) + int64_t(coefs[dist]) * int64_t(fwd[dist]);
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat>
+   SRD_TARGET("avx2") void FixedStereoAVX2(const SampleFormat * back, const SampleFormat * fwd, const int32_t * coefs, size_t count, int64_t * out)
+   {
+      //two stereo frames per register; backward pairs have their 128 bit halves swapped
+      __m256i acc = _mm256_setzero_si256();
+      size_t dist = 0;
+      for (; dist + 2 <= count; dist += 2)
+      {
+         __m256i b = _mm256_permute4x64_epi64(load4i(back - 2 * dist - 2), 0x4E);
+         __m256i c = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(coefs + dist)))), 0x50);
+         acc = multiplyAdd(c, b, load4i(fwd + 2 * dist), acc);
+      }
+      alignas(32) int64_t lanes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+      int64_t left = lanes[0] + lanes[2], right = lanes[1] + lanes[3];
+      for (; dist < count; dist++)
+      {
+         left += int64_t(coefs[dist]) * int64_t(*(back - 2 * dist)) + int64_t(coefs[dist]) * int64_t(fwd[2 * dist]);
+         right += int64_t(coefs[dist]) * int64_t(*(back - 2 * dist + 1)) + int64_t(coefs[dist]) * int64_t(fwd[2 * dist + 1]);
+      }
+      out[0] = left;
+      out[1] = right;
+   }
+}
+
+#endif
+
+//returns the fastest folded kernel for the processor; the choice is made once per process
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+inline FoldedKernel<SampleFormat, CoefficientFormat, channels> SelectFoldedKernel()
+{
+   constexpr bool vectorized = (std::is_same<SampleFormat, double>::value || std::is_same<SampleFormat, float>::value)
+                               && (std::is_same<CoefficientFormat, double>::value || std::is_same<CoefficientFormat, float>::value);
+   static const FoldedKernel<SampleFormat, CoefficientFormat, channels> kernel = []() -> FoldedKernel<SampleFormat, CoefficientFormat, channels>
+   {
+#ifdef SRD_X86
+      if constexpr (vectorized && (channels == 1 || channels == 2))
+      {
+         using namespace simd_kernels;
+         switch (ActiveSimdLevel())
+         {
+         case SimdLevel::AVX512: return (channels == 1) ? MonoAVX512<SampleFormat, CoefficientFormat> : StereoAVX512<SampleFormat, CoefficientFormat>;
+         case SimdLevel::AVX2:   return (channels == 1) ? MonoAVX2<SampleFormat, CoefficientFormat> : StereoAVX2<SampleFormat, CoefficientFormat>;
+         case SimdLevel::SSE2:   return (channels == 1) ? MonoSSE2<SampleFormat, CoefficientFormat> : StereoSSE2<SampleFormat, CoefficientFormat>;
+         default: break;
+         }
+      }
+      else if constexpr ((std::is_same<SampleFormat, int16_t>::value || std::is_same<SampleFormat, int32_t>::value)
+                         && std::is_same<CoefficientFormat, int32_t>::value && (channels == 1 || channels == 2))
+      {
+         //the fixed point kernels need no more than AVX2
+         using namespace simd_kernels;
+         if (ActiveSimdLevel() >= SimdLevel::AVX2)
+            return (channels == 1) ? FixedMonoAVX2<SampleFormat> : FixedStereoAVX2<SampleFormat>;
+      }
+      else if constexpr (vectorized && channels >= 4 && channels % 2 == 0)
+      {
+         //every tap is a whole frame of 256 bit registers, which the AVX-512 level uses as well
+         using namespace simd_kernels;
+         switch (ActiveSimdLevel())
+         {
+         case SimdLevel::AVX512:
+         case SimdLevel::AVX2:   return MultichannelAVX2<SampleFormat, CoefficientFormat, channels>;
+         case SimdLevel::SSE2:   return MultichannelSSE2<SampleFormat, CoefficientFormat, channels>;
+         default: break;
+         }
+      }
+#endif
+      return FoldedDotScalar<SampleFormat, CoefficientFormat, channels>;
+   }();
+   return kernel;
+}
+
+/* Dot product kernels
+For every channel c, a kernel calculates
+   out[c] = sum over k from 0 to count-1 of coefs[k]*in[c + k*channels]
+for filters that aren't symmetric, such as the phase tables of a polyphase resampler.
+Like the folded kernels they accumulate in double precision.
+*/
+
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+using DotKernel = void(*)(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, AccumulatorFormat<CoefficientFormat> * out);
+
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+inline void DotScalar(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, AccumulatorFormat<CoefficientFormat> * out)
+{
+   using Accumulator = AccumulatorFormat<CoefficientFormat>;
+
+   //four partial sums per channel keep the additions independent
+   Accumulator acc[4][channels]{};
+   size_t k = 0;
+   for (; k + 4 <= count; k += 4)
+   {
+      for (size_t lane = 0; lane < 4; lane++)
+      {
+         for (size_t c = 0; c < channels; c++)
+            acc[lane][c] += Accumulator(coefs[k + lane]) * Accumulator(in[(k + lane) * channels + c]);
+      }
+   }
+   for (; k < count; k++)
+   {
+      for (size_t c = 0; c < channels; c++)
+         acc[0][c] += Accumulator(coefs[k]) * Accumulator(in[k * channels + c]);
+   }
+   for (size_t c = 0; c < channels; c++)
+      out[c] = (acc[0][c] + acc[1][c]) + (acc[2][c] + acc[3][c]);
+}
+
+#ifdef SRD_X86
+
+namespace simd_kernels {
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("sse2") void MonoDotSSE2(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+      size_t k = 0;
+      for (; k + 4 <= count; k += 4)
+      {
+         acc0 = _mm_add_pd(acc0, _mm_mul_pd(load2(coefs + k), load2(in + k)));
+         acc1 = _mm_add_pd(acc1, _mm_mul_pd(load2(coefs + k + 2), load2(in + k + 2)));
+      }
+      __m128d acc = _mm_add_pd(acc0, acc1);
+      double sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+      for (; k < count; k++)
+         sum += double(coefs[k]) * double(in[k]);
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("sse2") void StereoDotSSE2(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+      size_t k = 0;
+      for (; k + 2 <= count; k += 2)
+      {
+         acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_set1_pd(double(coefs[k])), load2(in + 2 * k)));
+         acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_set1_pd(double(coefs[k + 1])), load2(in + 2 * k + 2)));
+      }
+      for (; k < count; k++)
+         acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_set1_pd(double(coefs[k])), load2(in + 2 * k)));
+      _mm_storeu_pd(out, _mm_add_pd(acc0, acc1));
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx2,fma") void MonoDotAVX2(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+      size_t k = 0;
+      for (; k + 8 <= count; k += 8)
+      {
+         acc0 = _mm256_fmadd_pd(load4(coefs + k), load4(in + k), acc0);
+         acc1 = _mm256_fmadd_pd(load4(coefs + k + 4), load4(in + k + 4), acc1);
+      }
+      acc0 = _mm256_add_pd(acc0, acc1);
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+      double sum = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+      for (; k < count; k++)
+         sum += double(coefs[k]) * double(in[k]);
+      out[0] = sum;
+   }
+
+   template<typename SampleFormat, typename CoefficientFormat>
+   SRD_TARGET("avx2,fma") void StereoDotAVX2(const SampleFormat * in, const CoefficientFormat * coefs, size_t count, double * out)
+   {
+      //two stereo frames per register, each multiplied by its own duplicated coefficient
+      __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+      size_t k = 0;
+      for (; k + 4 <= count; k += 4)
+      {
+         __m256d c0 = _mm256_permute4x64_pd(_mm256_castpd128_pd256(load2(coefs + k)), 0x50);
+         __m256d c1 = _mm256_permute4x64_pd(_mm256_castpd128_pd256(load2(coefs + k + 2)), 0x50);
+         acc0 = _mm256_fmadd_pd(c0, load4(in + 2 * k), acc0);
+         acc1 = _mm256_fmadd_pd(c1, load4(in + 2 * k + 4), acc1);
+      }
+      acc0 = _mm256_add_pd(acc0, acc1);
+      __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+      for (; k < count; k++)
+         acc = _mm_add_pd(acc, _mm_mul_pd(_mm_set1_pd(double(coefs[k])), load2(in + 2 * k)));
+      _mm_storeu_pd(out, acc);
+   }
+}
+
+#endif
+
+//returns the fastest dot product kernel for the processor; the AVX-512 level uses the AVX2 kernels
+template<typename SampleFormat, typename CoefficientFormat, size_t channels>
+inline DotKernel<SampleFormat, CoefficientFormat, channels> SelectDotKernel()
+{
+   constexpr bool vectorized = (std::is_same<SampleFormat, double>::value || std::is_same<SampleFormat, float>::value)
+                               && (std::is_same<CoefficientFormat, double>::value || std::is_same<CoefficientFormat, float>::value)
+                               && (channels == 1 || channels == 2);
+   static const DotKernel<SampleFormat, CoefficientFormat, channels> kernel = []() -> DotKernel<SampleFormat, CoefficientFormat, channels>
+   {
+#ifdef SRD_X86
+      if constexpr (vectorized)
+      {
+         using namespace simd_kernels;
+         switch (ActiveSimdLevel())
+         {
+         case SimdLevel::AVX512:
+         case SimdLevel::AVX2:   return (channels == 1) ? MonoDotAVX2<SampleFormat, CoefficientFormat> : StereoDotAVX2<SampleFormat, CoefficientFormat>;
+         case SimdLevel::SSE2:   return (channels == 1) ? MonoDotSSE2<SampleFormat, CoefficientFormat> : StereoDotSSE2<SampleFormat, CoefficientFormat>;
+         default: break;
+         }
+      }
+#endif
+      return DotScalar<SampleFormat, CoefficientFormat, channels>;
+   }();
+   return kernel;
+}
+
+/* Interleave and deinterleave
+Convert between libsndfile's interleaved frames and one contiguous buffer per channel.
+Stereo double and float data are shuffled with vector instructions.
+*/
+
+#ifdef SRD_X86
+
+namespace simd_kernels {
+
+   SRD_TARGET("avx2") inline size_t DeinterleaveStereo(const double * in, size_t count, double * left, double * right)
+   {
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+         __m256d a = _mm256_loadu_pd(in + 2 * i), b = _mm256_loadu_pd(in + 2 * i + 4);
+         _mm256_storeu_pd(left + i, _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), 0xD8));
+         _mm256_storeu_pd(right + i, _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), 0xD8));
+      }
+      return i;
+   }
+
+   SRD_TARGET("avx2") inline size_t InterleaveStereo(const double * left, const double * right, size_t count, double * out)
+   {
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+         __m256d l = _mm256_permute4x64_pd(_mm256_loadu_pd(left + i), 0xD8), r = _mm256_permute4x64_pd(_mm256_loadu_pd(right + i), 0xD8);
+         _mm256_storeu_pd(out + 2 * i, _mm256_unpacklo_pd(l, r));
+         _mm256_storeu_pd(out + 2 * i + 4, _mm256_unpackhi_pd(l, r));
+      }
+      return i;
+   }
+
+   SRD_TARGET("sse2") inline size_t DeinterleaveStereo(const float * in, size_t count, float * left, float * right)
+   {
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+         __m128 a = _mm_loadu_ps(in + 2 * i), b = _mm_loadu_ps(in + 2 * i + 4);
+         _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+         _mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+      }
+      return i;
+   }
+
+   SRD_TARGET("sse2") inline size_t InterleaveStereo(const float * left, const float * right, size_t count, float * out)
+   {
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+         __m128 l = _mm_loadu_ps(left + i), r = _mm_loadu_ps(right + i);
+         _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(l, r));
+         _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(l, r));
+      }
+      return i;
+   }
+}
+
+#endif
+
+//copies count interleaved frames of in into the channel buffers out[0]...out[channels-1]
+template<typename SampleFormat>
+inline void Deinterleave(const SampleFormat * in, size_t channels, size_t count, SampleFormat * const * out)
+{
+   size_t first = 0;
+#ifdef SRD_X86
+   if constexpr (std::is_same<SampleFormat, double>::value)
+   {
+      if (channels == 2 && ActiveSimdLevel() >= SimdLevel::AVX2)
+         first = simd_kernels::DeinterleaveStereo(in, count, out[0], out[1]);
+   }
+   else if constexpr (std::is_same<SampleFormat, float>::value)
+   {
+      if (channels == 2 && ActiveSimdLevel() >= SimdLevel::SSE2)
+         first = simd_kernels::DeinterleaveStereo(in, count, out[0], out[1]);
+   }
+#endif
+   for (size_t i = first; i < count; i++)
+      for (size_t c = 0; c < channels; c++)
+         out[c][i] = in[i * channels + c];
+}
+
+//copies count frames from the channel buffers in[0]...in[channels-1] into interleaved out
+template<typename SampleFormat>
+inline void Interleave(const SampleFormat * const * in, size_t channels, size_t count, SampleFormat * out)
+{
+   size_t first = 0;
+#ifdef SRD_X86
+   if constexpr (std::is_same<SampleFormat, double>::value)
+   {
+      if (channels == 2 && ActiveSimdLevel() >= SimdLevel::AVX2)
+         first = simd_kernels::InterleaveStereo(in[0], in[1], count, out);
+   }
+   else if constexpr (std::is_same<SampleFormat, float>::value)
+   {
+      if (channels == 2 && ActiveSimdLevel() >= SimdLevel::SSE2)
+         first = simd_kernels::InterleaveStereo(in[0], in[1], count, out);
+   }
+#endif
+   for (size_t i = first; i < count; i++)
+      for (size_t c = 0; c < channels; c++)
+         out[i * channels + c] = in[c][i];
+}
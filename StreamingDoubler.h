@@ -0,0 +1,130 @@
+/*
+Streaming Doubler
+
+A stateful SRDoubler front end for audio that arrives in blocks.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "FileUpsampler.h"
+
+/* Streaming doubler
+An interpolated frame depends on the halfWidth input frames that follow it,
+so the stream is delayed by Latency() input frames: Process() accepts blocks
+of any size and always returns twice as many frames, the first 2*Latency()
+of which are silence. Flush() returns the last 2*Latency() frames. The output
+without the leading silence is identical to that of SRDoubler::Run() for the
+concatenated input.
+
+The class keeps the last table_width-1 input frames as history in a linear
+buffer, which is compacted once the consumed part grows longer than the table.
+With DYNAMIC_TABLE_WIDTH the width is given to the constructor.
+*/
+
+template<typename SampleFormat, uint8_t numChannels, size_t table_width> class CStreamingDoubler
+{
+public:
+   using Doubler = SRDoubler<SampleFormat, numChannels, table_width>;
+   using SampleFrame = typename Doubler::SampleFrame;
+   using FrameSpan = typename Doubler::FrameSpan;
+   using FrameVector = typename Doubler::FrameVector;
+   using size_type = typename Doubler::size_type;
+   using CoefficientFormat = typename Doubler::CoefficientFormat;
+
+   template<typename FilterType>
+   CStreamingDoubler(const FilterType& filter) : m_doubler{ m_no_input, filter }
+   {
+      Reset();
+   }
+
+   CStreamingDoubler(const CoefficientFormat * coefficients, size_t width) : m_doubler{ m_no_input, coefficients, width }
+   {
+      Reset();
+   }
+
+   //input frames between the moment a frame enters and the moment it leaves the doubler
+   size_type Latency() const
+   {
+      return m_doubler.Width() / 2;
+   }
+
+   //forgets the history and starts a new stream
+   void Reset()
+   {
+      //history starts with the halfWidth-1 silent frames preceding the first input frame
+      m_history.assign(Latency() - 1, SampleFrame{});
+      m_start = 0;
+      m_silent_pairs = Latency();
+   }
+
+   //consumes count input frames and writes exactly 2*count frames to out
+   void Process(const SampleFrame * in, size_type count, SampleFrame * out)
+   {
+      m_history.insert(m_history.end(), in, in + count);
+
+      //the stream starts with silence until the first interpolated frame can be calculated
+      size_type silent = std::min(m_silent_pairs, count);
+      std::fill(out, out + 2 * silent, SampleFrame{});
+      m_silent_pairs -= silent;
+      out += 2 * silent;
+
+      //frame m_start+halfWidth-1 is the next to be upsampled; it needs halfWidth frames after it
+      size_type ready = count - silent;
+      m_doubler.RunInterior(m_history.data() + m_start + Latency() - 1, static_cast<typename Doubler::index_type>(ready), out);
+      m_start += ready;
+
+      if (m_start >= m_doubler.Width())
+      {
+         m_history.erase(m_history.begin(), m_history.begin() + m_start);
+         m_start = 0;
+      }
+   }
+
+   FrameVector Process(const FrameSpan& in)
+   {
+      FrameVector output(2 * in.size());
+
+      Process(in.data(), in.size(), output.data());
+
+      return output;
+   }
+
+   //writes the last 2*Latency() frames to out and resets the doubler
+   void Flush(SampleFrame * out)
+   {
+      FrameVector silence(Latency());
+
+      Process(silence.data(), silence.size(), out);
+      Reset();
+   }
+
+   FrameVector Flush()
+   {
+      FrameVector output(2 * Latency());
+
+      Flush(output.data());
+
+      return output;
+   }
+
+private:
+
+   const FrameSpan m_no_input{};   //the doubler is only used through RunInterior
+   Doubler m_doubler;
+   FrameVector m_history;          //frames from m_start on are still needed
+   size_type m_start;
+   size_type m_silent_pairs;       //silent output frame pairs still to be written
+};
@@ -0,0 +1,289 @@
+/*
+Upsampler Statistics
+
+Times the stages of a file conversion and counts the work it does, and
+writes them as a JSON report.
+
+Copyright  2018 Lev Minkovsky
+
+This software is licensed under the MIT License (MIT).
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/* Stages
+Every moment of a conversion is attributed to at most one stage. Stage timers
+nest: a timer started while another one runs on the same thread pauses it, so
+designing the tables of an engine built in the middle of upsampling counts
+as design and not as upsampling. Stages that run concurrently on different
+threads, as those of the pipeline do, are summed, so their total may exceed
+the wall time.
+*/
+
+enum class UpsamplerStage
+{
+   Open,       //opening the files and reading their headers
+   Design,     //calculating, mapping or looking up filter tables and building engines
+   Allocate,   //allocating the input and block buffers; engines allocate their output while upsampling
+   Read,       //reading and decoding the input
+   Upsample,
+   Verify,
+   Write,      //encoding and writing the output
+   Close,      //closing the files, which flushes the output
+   Count
+};
+
+inline const char * UpsamplerStageName(UpsamplerStage stage)
+{
+   static const char * const NAMES[] = { "open", "design", "allocate", "read", "upsample", "verify", "write", "close" };
+   return NAMES[static_cast<size_t>(stage)];
+}
+
+//what a conversion processed; macs are the multiply-accumulates a direct form convolution needs for it, whatever engine runs
+struct SUpsamplerCounts
+{
+   uint64_t channels = 0;
+   uint64_t input_frames = 0;
+   uint64_t output_frames = 0;
+   uint64_t input_bytes = 0;    //sizes of the files
+   uint64_t output_bytes = 0;
+   uint64_t macs = 0;
+   bool mapped = false;         //the input was used right in the mapped file
+};
+
+/* Upsampler statistics
+Collects the statistics of one conversion. Add() may be called from any
+thread.
+*/
+
+class CUpsamplerStats
+{
+public:
+   using clock_type = std::chrono::steady_clock;
+
+   template<typename Duration> void Add(UpsamplerStage stage, Duration time)
+   {
+      m_nanoseconds[static_cast<size_t>(stage)] += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+   }
+
+   double Milliseconds(UpsamplerStage stage) const
+   {
+      return m_nanoseconds[static_cast<size_t>(stage)] * 1E-6;
+   }
+
+   SUpsamplerCounts& Counts()
+   {
+      return m_counts;
+   }
+
+   const SUpsamplerCounts& Counts() const
+   {
+      return m_counts;
+   }
+
+   void SetFiles(const std::string& input, const std::string& output)
+   {
+      m_input = input;
+      m_output = output;
+   }
+
+   //mode and format should be string literals
+   void SetMode(const char * mode)
+   {
+      m_mode = mode;
+   }
+
+   void SetFormat(const char * format)
+   {
+      m_format = format;
+   }
+
+   void SetResult(bool succeeded, clock_type::duration wall)
+   {
+      m_succeeded = succeeded;
+      m_wall_milliseconds = std::chrono::duration<double, std::milli>(wall).count();
+   }
+
+   bool Succeeded() const
+   {
+      return m_succeeded;
+   }
+
+   double WallMilliseconds() const
+   {
+      return m_wall_milliseconds;
+   }
+
+   void WriteJson(std::ostream& out, const char * indent) const
+   {
+      const double seconds = m_wall_milliseconds * 1E-3;
+      out << indent << "{ \"input\": " << JsonString(m_input) << ", \"output\": " << JsonString(m_output)
+          << ", \"status\": \"" << (m_succeeded ? "ok" : "failed") << "\", \"mode\": \"" << m_mode << "\", \"sample_format\": \"" << m_format << "\",\n";
+      out << indent << "  \"channels\": " << m_counts.channels << ", \"input_frames\": " << m_counts.input_frames
+          << ", \"output_frames\": " << m_counts.output_frames << ", \"input_bytes\": " << m_counts.input_bytes
+          << ", \"output_bytes\": " << m_counts.output_bytes << ", \"macs\": " << m_counts.macs
+          << ", \"mapped\": " << (m_counts.mapped ? "true" : "false") << ",\n";
+      out << indent << "  \"wall_ms\": " << m_wall_milliseconds << ", \"stages_ms\": ";
+      WriteStages(out, [this](UpsamplerStage stage) { return Milliseconds(stage); });
+      out << ",\n" << indent << "  \"output_frames_per_second\": " << (seconds > 0 ? m_counts.output_frames / seconds : 0.)
+          << ", \"macs_per_second\": " << (seconds > 0 ? m_counts.macs / seconds : 0.) << " }";
+   }
+
+   //writes a JSON object with the milliseconds milliseconds(stage) returns for every stage
+   template<typename Milliseconds> static void WriteStages(std::ostream& out, Milliseconds milliseconds)
+   {
+      out << "{ ";
+      for (size_t stage = 0; stage < static_cast<size_t>(UpsamplerStage::Count); stage++)
+         out << (stage ? ", " : "") << "\"" << UpsamplerStageName(static_cast<UpsamplerStage>(stage)) << "\": " << milliseconds(static_cast<UpsamplerStage>(stage));
+      out << " }";
+   }
+
+   static std::string JsonString(const std::string& text)
+   {
+      std::string quoted = "\"";
+      for (char c : text)
+      {
+         if (c == '"' || c == '\\')
+            quoted += '\\';
+         if (static_cast<unsigned char>(c) < 0x20)
+         {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            quoted += escaped;
+         }
+         else
+            quoted += c;
+      }
+      return quoted + "\"";
+   }
+
+private:
+
+   std::atomic<int64_t> m_nanoseconds[static_cast<size_t>(UpsamplerStage::Count)] = {};
+   SUpsamplerCounts m_counts;
+   std::string m_input;
+   std::string m_output;
+   const char * m_mode = "none";
+   const char * m_format = "none";
+   bool m_succeeded = false;
+   double m_wall_milliseconds = 0;
+};
+
+/* Stage timer
+Attributes the time from its construction to its destruction to a stage of
+stats, less the time of the timers nested in it. A null stats pointer makes
+it do nothing.
+*/
+
+class CStageTimer
+{
+public:
+   CStageTimer(CUpsamplerStats * stats, UpsamplerStage stage) : m_stats{ stats }, m_stage{ stage }
+   {
+      if (!m_stats)
+         return;
+      m_parent = current();
+      m_start = CUpsamplerStats::clock_type::now();
+      if (m_parent)
+         m_parent->m_stats->Add(m_parent->m_stage, m_start - m_parent->m_start);
+      current() = this;
+   }
+
+   ~CStageTimer()
+   {
+      if (!m_stats)
+         return;
+      auto now = CUpsamplerStats::clock_type::now();
+      m_stats->Add(m_stage, now - m_start);
+      current() = m_parent;
+      if (m_parent)
+         m_parent->m_start = now;
+   }
+
+   CStageTimer(const CStageTimer&) = delete;
+   CStageTimer& operator=(const CStageTimer&) = delete;
+
+private:
+
+   CUpsamplerStats * m_stats;
+   UpsamplerStage m_stage;
+   CStageTimer * m_parent = nullptr;
+   CUpsamplerStats::clock_type::time_point m_start;
+
+   //the innermost timer running on this thread
+   static CStageTimer *& current()
+   {
+      static thread_local CStageTimer * timer = nullptr;
+      return timer;
+   }
+};
+
+//returns what produce() returns, attributing the time it takes to the stage
+template<typename Produce> inline auto TimeStage(CUpsamplerStats * stats, UpsamplerStage stage, Produce produce)
+{
+   CStageTimer timer{ stats, stage };
+   return produce();
+}
+
+/* Writes the report of a run: the statistics of every file and their totals.
+The stage totals are summed over the files, which may have been converted
+concurrently, while wall_ms is the time of the whole run.
+*/
+inline void WriteStatsReport(std::ostream& out, const std::vector<const CUpsamplerStats *>& files, const char * simd, unsigned jobs, double wall_milliseconds)
+{
+   SUpsamplerCounts totals;
+   size_t succeeded = 0;
+   for (const CUpsamplerStats * file : files)
+   {
+      const SUpsamplerCounts& counts = file->Counts();
+      totals.input_frames += counts.input_frames;
+      totals.output_frames += counts.output_frames;
+      totals.input_bytes += counts.input_bytes;
+      totals.output_bytes += counts.output_bytes;
+      totals.macs += counts.macs;
+      succeeded += file->Succeeded();
+   }
+
+   const double seconds = wall_milliseconds * 1E-3;
+   out << "{\n";
+   out << "  \"simd\": \"" << simd << "\",\n";
+   out << "  \"jobs\": " << jobs << ",\n";
+   out << "  \"files\": [\n";
+   for (size_t f = 0; f < files.size(); f++)
+   {
+      files[f]->WriteJson(out, "    ");
+      out << ((f + 1 < files.size()) ? ",\n" : "\n");
+   }
+   out << "  ],\n";
+   out << "  \"totals\": { \"files\": " << files.size() << ", \"succeeded\": " << succeeded
+       << ", \"input_frames\": " << totals.input_frames << ", \"output_frames\": " << totals.output_frames
+       << ", \"input_bytes\": " << totals.input_bytes << ", \"output_bytes\": " << totals.output_bytes << ", \"macs\": " << totals.macs << ",\n";
+   out << "    \"wall_ms\": " << wall_milliseconds << ", \"stages_ms\": ";
+   CUpsamplerStats::WriteStages(out, [&](UpsamplerStage stage)
+   {
+      double milliseconds = 0;
+      for (const CUpsamplerStats * file : files)
+         milliseconds += file->Milliseconds(stage);
+      return milliseconds;
+   });
+   out << ",\n    \"output_frames_per_second\": " << (seconds > 0 ? totals.output_frames / seconds : 0.)
+       << ", \"macs_per_second\": " << (seconds > 0 ? totals.macs / seconds : 0.) << " }\n";
+   out << "}\n";
+}
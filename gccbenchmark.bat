@@ -0,0 +1,3 @@
+del Staging\SRDoublerBenchmark.exe
+g++ -std=c++17 -O2 -march=native SRDoublerBenchmark.cpp -o Staging\SRDoublerBenchmark.exe
+Staging\SRDoublerBenchmark.exe --output Staging\benchmark.json
\ No newline at end of file